@@ -1,6 +1,11 @@
 #pragma once
 
+#include "band/allocation.h"
+#include "band/arena.h"
 #include "band/control.h"
 #include "band/control/all.h"
+#include "band/frame.h"
 #include "band/interface.h"
+#include "band/loop.h"
+#include "band/scheduler.h"
 #include "band/scope.h"
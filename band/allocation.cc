@@ -0,0 +1,58 @@
+#include "band/allocation.h"
+
+#ifdef BAND_COUNT_ALLOCATIONS
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<band::Size> allocations{0u};
+
+}  // namespace
+
+void* operator new(size_t n) {
+  allocations.fetch_add(1u, std::memory_order_relaxed);
+
+  void* p = std::malloc(n == 0u ? 1u : n);
+  if (p == nullptr) {
+    throw std::bad_alloc{};
+  }
+
+  return p;
+}
+
+void* operator new[](size_t n) {
+  return operator new(n);
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  std::free(p);
+}
+
+#endif  // BAND_COUNT_ALLOCATIONS
+
+namespace band {
+
+std::optional<Size> Allocations() {
+#ifdef BAND_COUNT_ALLOCATIONS
+  return allocations.load(std::memory_order_relaxed);
+#else
+  return std::nullopt;
+#endif  // BAND_COUNT_ALLOCATIONS
+}
+
+}  // namespace band
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <optional>
+
+#include "band/interface.h"
+
+namespace band {
+
+// Allocations made on the heap so far or nullopt if they aren't counted.
+//
+// Allocations are counted if band is built with 'BAND_COUNT_ALLOCATIONS'
+// defined, which replaces the global 'operator new' with one that counts.
+// Programs replacing 'operator new' themselves can't count allocations this
+// way.
+std::optional<Size> Allocations();
+
+}  // namespace band
@@ -0,0 +1,72 @@
+#include "band/arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace band {
+
+namespace {
+
+// Offset of the first address at or after the offset into the block that has
+// the alignment.
+size_t AlignOffset(
+    const unsigned char* block, size_t offset, size_t alignment) {
+  uintptr_t address = reinterpret_cast<uintptr_t>(block) + offset;
+  uintptr_t aligned = (address + alignment - 1u) & ~(alignment - 1u);
+  return offset + (aligned - address);
+}
+
+}  // namespace
+
+void* Arena::Allocate(size_t size, size_t alignment) {
+  if (block_ == nullptr) {
+    capacity_ = kBlockSize;
+    block_.reset(new unsigned char[capacity_]);
+  }
+
+  size_t offset = AlignOffset(block_.get(), used_, alignment);
+  if (overflow_.empty() && offset + size <= capacity_) {
+    used_ = offset + size;
+    return block_.get() + offset;
+  }
+
+  overflowed_ += size + alignment;
+
+  if (!overflow_.empty()) {
+    offset = AlignOffset(overflow_.back().get(), overflow_used_, alignment);
+    if (offset + size <= overflow_capacity_) {
+      overflow_used_ = offset + size;
+      return overflow_.back().get() + offset;
+    }
+  }
+
+  overflow_capacity_ = std::max(capacity_, size + alignment);
+  overflow_.emplace_back(new unsigned char[overflow_capacity_]);
+
+  offset = AlignOffset(overflow_.back().get(), 0u, alignment);
+  overflow_used_ = offset + size;
+  return overflow_.back().get() + offset;
+}
+
+void Arena::Reset() {
+  if (overflowed_ > 0u) {
+    capacity_ += overflowed_;
+    block_.reset(new unsigned char[capacity_]);
+    overflow_.clear();
+  }
+
+  used_ = 0u;
+  overflow_capacity_ = 0u;
+  overflow_used_ = 0u;
+  overflowed_ = 0u;
+}
+
+size_t Arena::Used() const {
+  return used_ + overflowed_;
+}
+
+size_t Arena::Capacity() const {
+  return capacity_;
+}
+
+}  // namespace band
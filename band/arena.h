@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace band {
+
+// Arena allocates by bumping an offset into a block and frees everything at
+// once when it's reset.
+//
+// Values in the arena are never destroyed so they must be trivially
+// destructible. Whatever didn't fit in the block since the last reset is added
+// to the block on the next reset so an arena reset every frame stops allocating
+// once frames stop growing.
+class Arena {
+  public:
+    // Size of the first block.
+    static constexpr size_t kBlockSize = 1u << 16u;
+
+    Arena() = default;
+
+    // Delete since allocations point into the arena's blocks.
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Allocate size bytes aligned to the alignment which must be a power of
+    // two.
+    void* Allocate(size_t size, size_t alignment);
+
+    // Create a value in the arena from the arguments.
+    template <typename T, typename... Args>
+    T* Create(Args&&... args);
+
+    // CreateArray of n value-initialized values.
+    template <typename T>
+    T* CreateArray(size_t n);
+
+    // Copy the n values into the arena.
+    template <typename T>
+    T* Copy(const T* values, size_t n);
+
+    // Reset the arena freeing everything allocated since the last reset.
+    void Reset();
+
+    // Used bytes since the last reset.
+    size_t Used() const;
+
+    // Capacity of the block.
+    size_t Capacity() const;
+
+  private:
+    std::unique_ptr<unsigned char[]> block_{};
+    size_t capacity_ = 0u;
+    size_t used_ = 0u;
+
+    // Blocks allocated since the last reset because the block was full.
+    std::vector<std::unique_ptr<unsigned char[]>> overflow_{};
+    size_t overflow_capacity_ = 0u;
+    size_t overflow_used_ = 0u;
+    // Bytes overflowed since the last reset.
+    size_t overflowed_ = 0u;
+
+};
+
+}  // namespace band
+
+namespace band {
+
+template <typename T, typename... Args>
+T* Arena::Create(Args&&... args) {
+  static_assert(
+      std::is_trivially_destructible_v<T>,
+      "values in arenas are never destroyed");
+
+  return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+T* Arena::CreateArray(size_t n) {
+  static_assert(
+      std::is_trivially_destructible_v<T>,
+      "values in arenas are never destroyed");
+
+  T* values = static_cast<T*>(Allocate(sizeof(T) * n, alignof(T)));
+  for (size_t i = 0u; i < n; i++) {
+    new (values + i) T();
+  }
+
+  return values;
+}
+
+template <typename T>
+T* Arena::Copy(const T* values, size_t n) {
+  static_assert(
+      std::is_trivially_copyable_v<T>,
+      "values are copied into arenas bytewise");
+
+  T* copy = static_cast<T*>(Allocate(sizeof(T) * n, alignof(T)));
+  for (size_t i = 0u; i < n; i++) {
+    new (copy + i) T(values[i]);
+  }
+
+  return copy;
+}
+
+}  // namespace band
@@ -0,0 +1,29 @@
+#include "band/asset/asset.pack.h"
+
+#include <cstdint>
+
+asm(
+    ".section .rodata.band_asset_Assets, \"a\"\n"
+    ".balign 16\n"
+    ".global band_asset_Assets_start\n"
+    "band_asset_Assets_start:\n"
+    ".incbin \"band/asset/asset.pack\"\n"
+    ".global band_asset_Assets_end\n"
+    "band_asset_Assets_end:\n"
+    ".previous\n");
+
+extern "C" const uint8_t band_asset_Assets_start[];
+extern "C" const uint8_t band_asset_Assets_end[];
+
+namespace band {
+namespace asset {
+
+band::File Assets() {
+  return band::File{
+    .bytes = band_asset_Assets_start,
+    .n = static_cast<size_t>(band_asset_Assets_end - band_asset_Assets_start)
+  };
+}
+
+}  // namespace asset
+}  // namespace band
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "band/interface.h"
+
+namespace band {
+namespace asset {
+
+// Assets is the embedded pack which can be opened with
+// 'band::asset::Pack'.
+band::File Assets();
+
+}  // namespace asset
+}  // namespace band
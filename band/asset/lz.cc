@@ -0,0 +1,142 @@
+#include "band/asset/lz.h"
+
+#include <algorithm>
+
+namespace band {
+namespace asset {
+
+namespace {
+
+constexpr size_t kWindowSize = 1u << 16u;
+constexpr size_t kMinMatch = 4u;
+
+}  // namespace
+
+LzReader::LzReader(const File& file) :
+  current_{file.bytes}, end_{file.bytes + file.n}, literal_{file.bytes},
+  window_(kWindowSize), decoded_{},
+  literals_{}, match_{}, offset_{},
+  is_done_{file.n == 0u}, is_corrupt_{false} { }
+
+size_t LzReader::Read(uint8_t* bytes, size_t n) {
+  size_t read = 0u;
+
+  while (read < n && !is_done_) {
+    if (literals_ > 0u) {
+      size_t count = std::min(literals_, n - read);
+      for (size_t i = 0u; i < count; i++) {
+        bytes[read + i] = literal_[i];
+        window_[(decoded_ + i) & (kWindowSize - 1u)] = literal_[i];
+      }
+
+      literal_ += count;
+      literals_ -= count;
+      decoded_ += count;
+      read += count;
+    } else if (match_ > 0u) {
+      // Byte-by-byte since the match can overlap what it's producing.
+      size_t count = std::min(match_, n - read);
+      for (size_t i = 0u; i < count; i++) {
+        uint8_t b = window_[(decoded_ - offset_) & (kWindowSize - 1u)];
+        bytes[read + i] = b;
+        window_[decoded_ & (kWindowSize - 1u)] = b;
+        decoded_++;
+      }
+
+      match_ -= count;
+      read += count;
+    } else if (!ReadBlock()) {
+      is_done_ = true;
+    }
+  }
+
+  if (literals_ == 0u && match_ == 0u && current_ == end_) {
+    is_done_ = true;
+  }
+
+  return read;
+}
+
+bool LzReader::IsDone() const {
+  return is_done_;
+}
+
+bool LzReader::IsCorrupt() const {
+  return is_corrupt_;
+}
+
+bool LzReader::ReadLength(size_t& length) {
+  if (length != 15u) {
+    return true;
+  }
+
+  while (current_ != end_) {
+    uint8_t b = *current_;
+    current_++;
+    length += b;
+
+    if (b != 255u) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool LzReader::ReadBlock() {
+  // The whole block is parsed up front and 'current_' is left at the next
+  // token while the literals and match are produced by 'Read'.
+  //
+  // Running out of blocks is the only way to stop that isn't corrupt.
+
+  if (current_ == end_) {
+    return false;
+  }
+
+  uint8_t token = *current_;
+  current_++;
+
+  size_t literals = token >> 4u;
+  if (!ReadLength(literals) ||
+      literals > static_cast<size_t>(end_ - current_)) {
+    is_corrupt_ = true;
+    return false;
+  }
+
+  literal_ = current_;
+  literals_ = literals;
+  current_ += literals;
+
+  // The final block has no match.
+  if (current_ == end_) {
+    return literals_ > 0u;
+  }
+
+  if (end_ - current_ < 2) {
+    is_corrupt_ = true;
+    return false;
+  }
+
+  size_t offset = static_cast<size_t>(current_[0]) |
+    static_cast<size_t>(current_[1]) << 8u;
+  current_ += 2;
+
+  if (offset == 0u || offset > decoded_ + literals) {
+    is_corrupt_ = true;
+    return false;
+  }
+
+  size_t match = token & 0x0fu;
+  if (!ReadLength(match)) {
+    is_corrupt_ = true;
+    return false;
+  }
+
+  match_ = match + kMinMatch;
+  offset_ = offset;
+
+  return true;
+}
+
+}  // namespace asset
+}  // namespace band
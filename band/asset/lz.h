@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "band/interface.h"
+
+namespace band {
+namespace asset {
+
+// LzReader decodes LZ-encoded bytes as they are read so the decoded file never
+// has to be fully materialized.
+//
+// The encoding is a sequence of blocks, each:
+//
+//   token: the high nibble is the literal-length and the low nibble is the
+//     match-length minus 4. A nibble of 15 is extended by the following bytes
+//     which are added until one isn't 255.
+//   literals: copied as is.
+//   offset: u16 little-endian distance back into the decoded bytes to copy the
+//     match from. The final block ends after its literals and has no match.
+//
+// Only a window of the last 64KiB of decoded bytes is kept.
+class LzReader {
+  public:
+    explicit LzReader(const File& file);
+
+    // Read up to 'n' decoded bytes into 'bytes' returning how many were read.
+    //
+    // Less than 'n' bytes are only read once the reader is done.
+    size_t Read(uint8_t* bytes, size_t n);
+
+    // IsDone returns if all bytes were decoded or the bytes were corrupt.
+    bool IsDone() const;
+
+    // IsCorrupt returns if decoding stopped because the bytes were corrupt.
+    bool IsCorrupt() const;
+
+  private:
+    bool ReadLength(size_t& length);
+    bool ReadBlock();
+
+    const uint8_t* current_;
+    const uint8_t* end_;
+    const uint8_t* literal_;
+
+    std::vector<uint8_t> window_;
+    size_t decoded_;
+
+    size_t literals_;
+    size_t match_;
+    size_t offset_;
+
+    bool is_done_;
+    bool is_corrupt_;
+};
+
+}  // namespace asset
+}  // namespace band
@@ -0,0 +1,204 @@
+#include "band/asset/pack.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace band {
+namespace asset {
+
+namespace {
+
+constexpr char kMagic[] = {'B', 'A', 'N', 'D'};
+constexpr uint32_t kVersion = 2u;
+constexpr size_t kHeaderSize = 16u;
+constexpr size_t kEntrySize = 40u;
+
+uint32_t ReadU32(const uint8_t* bytes) {
+  return static_cast<uint32_t>(bytes[0]) |
+    static_cast<uint32_t>(bytes[1]) << 8u |
+    static_cast<uint32_t>(bytes[2]) << 16u |
+    static_cast<uint32_t>(bytes[3]) << 24u;
+}
+
+uint64_t ReadU64(const uint8_t* bytes) {
+  return static_cast<uint64_t>(ReadU32(bytes)) |
+    static_cast<uint64_t>(ReadU32(bytes + 4u)) << 32u;
+}
+
+// IsInBounds returns if the range starting at the offset with the size fits in
+// 'n' bytes without overflowing.
+bool IsInBounds(uint64_t offset, uint64_t size, size_t n) {
+  return offset <= n && size <= n - offset;
+}
+
+// CompareName compares the entry's name to the name like 'strcmp'.
+int CompareName(
+    const uint8_t* name, size_t name_n,
+    const Text& other) {
+  int compared = std::memcmp(name, other.data(), std::min(name_n, other.size()));
+  if (compared != 0) {
+    return compared;
+  }
+
+  if (name_n == other.size()) {
+    return 0;
+  }
+
+  return name_n < other.size() ? -1 : 1;
+}
+
+}  // namespace
+
+Pack::Pack() :
+  bytes_{nullptr}, n_{}, count_{},
+  mapping_{nullptr}, mapping_n_{} { }
+
+Pack::~Pack() {
+  Close();
+}
+
+bool Pack::Open(const Text& path) {
+  Close();
+
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat status{};
+  if (::fstat(fd, &status) != 0 || status.st_size <= 0) {
+    ::close(fd);
+    return false;
+  }
+
+  size_t n = static_cast<size_t>(status.st_size);
+  void* mapping = ::mmap(nullptr, n, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid after the descriptor is closed.
+  ::close(fd);
+
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+
+  mapping_ = mapping;
+  mapping_n_ = n;
+  bytes_ = reinterpret_cast<const uint8_t*>(mapping);
+  n_ = n;
+
+  if (!Index()) {
+    Close();
+    return false;
+  }
+
+  return true;
+}
+
+bool Pack::Open(const File& file) {
+  Close();
+
+  bytes_ = file.bytes;
+  n_ = file.n;
+
+  if (!Index()) {
+    Close();
+    return false;
+  }
+
+  return true;
+}
+
+void Pack::Close() {
+  if (mapping_ != nullptr) {
+    ::munmap(mapping_, mapping_n_);
+  }
+
+  bytes_ = nullptr;
+  n_ = 0u;
+  count_ = 0u;
+  mapping_ = nullptr;
+  mapping_n_ = 0u;
+}
+
+bool Pack::IsOpen() const {
+  return bytes_ != nullptr;
+}
+
+std::optional<File> Pack::Find(const Text& name) const {
+  size_t low = 0u;
+  size_t high = count_;
+
+  while (low < high) {
+    size_t middle = low + (high - low) / 2u;
+    const uint8_t* entry = bytes_ + kHeaderSize + middle * kEntrySize;
+
+    int compared = CompareName(
+        bytes_ + ReadU32(entry), ReadU32(entry + 4u), name);
+
+    if (compared < 0) {
+      low = middle + 1u;
+    } else if (compared > 0) {
+      high = middle;
+    } else {
+      return File{
+        .bytes = bytes_ + ReadU64(entry + 8u),
+        .n = static_cast<size_t>(ReadU64(entry + 16u)),
+        .encoding = ReadU32(entry + 32u) == 1u ? Encoding::kLz : Encoding::kRaw,
+        .decoded_n = static_cast<size_t>(ReadU64(entry + 24u))
+      };
+    }
+  }
+
+  return std::nullopt;
+}
+
+std::vector<Text> Pack::Names() const {
+  std::vector<Text> names{};
+  names.reserve(count_);
+
+  for (size_t i = 0u; i < count_; i++) {
+    const uint8_t* entry = bytes_ + kHeaderSize + i * kEntrySize;
+
+    names.emplace_back(
+        reinterpret_cast<const char*>(bytes_ + ReadU32(entry)),
+        ReadU32(entry + 4u));
+  }
+
+  return names;
+}
+
+bool Pack::Index() {
+  // Everything is validated once here so finding files can trust the pack.
+
+  if (bytes_ == nullptr || n_ < kHeaderSize ||
+      std::memcmp(bytes_, kMagic, sizeof(kMagic)) != 0 ||
+      ReadU32(bytes_ + 4u) != kVersion) {
+    return false;
+  }
+
+  uint64_t count = ReadU32(bytes_ + 8u);
+  if (!IsInBounds(kHeaderSize, count * kEntrySize, n_)) {
+    return false;
+  }
+
+  for (uint64_t i = 0u; i < count; i++) {
+    const uint8_t* entry = bytes_ + kHeaderSize + i * kEntrySize;
+
+    if (!IsInBounds(ReadU32(entry), ReadU32(entry + 4u), n_) ||
+        !IsInBounds(ReadU64(entry + 8u), ReadU64(entry + 16u), n_) ||
+        ReadU32(entry + 32u) > 1u) {
+      return false;
+    }
+  }
+
+  count_ = static_cast<size_t>(count);
+
+  return true;
+}
+
+}  // namespace asset
+}  // namespace band
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "band/interface.h"
+
+namespace band {
+namespace asset {
+
+// Pack is an indexed archive of files produced by 'cmd/pack-assets'.
+//
+// Files found in the pack are views of the pack's bytes so nothing is copied.
+// Encoded files are left encoded for the interface to decode while loading.
+// A pack can either be opened from a file, which is memory-mapped, or from
+// bytes already in memory like a pack embedded in the binary.
+//
+// All integers are little-endian and offsets are from the start of the pack:
+//
+//   header:
+//     0  magic 'BAND'
+//     4  u32 version
+//     8  u32 number of entries
+//     12 u32 reserved
+//   entries, sorted by name, each:
+//     0  u32 offset of the name
+//     4  u32 size of the name
+//     8  u64 offset of the data
+//     16 u64 size of the data
+//     24 u64 size of the data once decoded
+//     32 u32 encoding where 0 is raw and 1 is LZ, see 'band/asset/lz.h'
+//     36 u32 reserved
+//   names, followed by the data of each entry aligned to 16 bytes.
+class Pack {
+  public:
+    Pack();
+
+    // ~Pack closes the pack.
+    ~Pack();
+
+    // Delete due to non-trivial destructor.
+    Pack(const Pack&) = delete;
+    Pack& operator=(const Pack&) = delete;
+    Pack(const Pack&&) = delete;
+    Pack& operator=(const Pack&&) = delete;
+
+    // Open the pack at the path by mapping it into memory.
+    //
+    // Returns false if the file couldn't be mapped or isn't a pack.
+    bool Open(const Text& path);
+    // Open the pack from bytes that outlive the pack.
+    //
+    // Returns false if the bytes aren't a pack.
+    bool Open(const File& file);
+    // Close if not already closed.
+    void Close();
+
+    bool IsOpen() const;
+
+    // Find the file with the name.
+    //
+    // The file is only valid while the pack is open.
+    std::optional<File> Find(const Text& name) const;
+
+    // Names of all the files in the pack in sorted order.
+    std::vector<Text> Names() const;
+
+  private:
+    bool Index();
+
+    const uint8_t* bytes_;
+    size_t n_;
+    size_t count_;
+
+    void* mapping_;
+    size_t mapping_n_;
+};
+
+}  // namespace asset
+}  // namespace band
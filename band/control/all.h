@@ -6,7 +6,12 @@
 #include "band/control/fixed_panel.h"
 #include "band/control/fps.h"
 #include "band/control/label.h"
+#include "band/control/layer.h"
+#include "band/control/perf_hud.h"
 #include "band/control/rectangle.h"
 #include "band/control/separator.h"
+#include "band/control/small_vector.h"
+#include "band/control/sprite_sheet.h"
 #include "band/control/stack_panel.h"
+#include "band/control/style.h"
 #include "band/control/texture.h"
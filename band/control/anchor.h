@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <utility>
 
 #include "band/control.h"
 #include "band/interface.h"
@@ -8,6 +9,41 @@
 namespace band {
 namespace control {
 
+// AnchorPosition is the position of a control with the area anchored at the
+// position to the alignments with respect to the reference area.
+inline Point AnchorPosition(
+    const Point& position, const ::band::Area& reference_area,
+    const ::band::Area& control_area,
+    const Alignment& horizontal_alignment, const Alignment& vertical_alignment,
+    const WindowArea& window_area) {
+  Point offset{};
+
+  if (horizontal_alignment == Alignment::kMiddle ||
+      horizontal_alignment == Alignment::kBottom) {
+    offset.x = SubtractDimensions(
+        reference_area.width, control_area.width, window_area.width);
+
+    if (horizontal_alignment == Alignment::kMiddle) {
+      offset.x = MultiplyDimension(offset.x, 0.5);
+    }
+  }
+
+  if (vertical_alignment == Alignment::kMiddle ||
+      vertical_alignment == Alignment::kBottom) {
+    offset.y = SubtractDimensions(
+        reference_area.height, control_area.height, window_area.height);
+
+    if (vertical_alignment == Alignment::kMiddle) {
+      offset.y = MultiplyDimension(offset.y, 0.5);
+    }
+  }
+
+  offset.x = AddDimensions(offset.x, position.x, window_area.width);
+  offset.y = AddDimensions(offset.y, position.y, window_area.height);
+
+  return offset;
+}
+
 // Anchor the control to an alignment with respect to the reference area.
 //
 // The anchor is in charge of drawing the control it is anchoring.
@@ -80,7 +116,7 @@ void Anchor<T>::SetReferenceArea(const ::band::Area& area) {
 
 template <typename T>
 void Anchor<T>::SetControl(T control) {
-  control_ = control;
+  control_ = std::move(control);
 }
 
 template <typename T>
@@ -95,32 +131,9 @@ void Anchor<T>::Update(const Point& position, const Interface& interface) {
   }
 
   ::band::Area control_area = control_.value()->Area(interface);
-  Point offset{};
-
-  if (horizontal_alignment_ == Alignment::kMiddle ||
-      horizontal_alignment_ == Alignment::kBottom) {
-    offset.x = SubtractDimensions(
-        area_.width, control_area.width,
-        interface.WindowArea().width);
-
-    if (horizontal_alignment_ == Alignment::kMiddle) {
-      offset.x = MultiplyDimension(offset.x, 0.5);
-    }
-  }
-
-  if (vertical_alignment_ == Alignment::kMiddle ||
-      vertical_alignment_ == Alignment::kBottom) {
-    offset.y = SubtractDimensions(
-        area_.height, control_area.height,
-        interface.WindowArea().height);
-
-    if (vertical_alignment_ == Alignment::kMiddle) {
-      offset.y = MultiplyDimension(offset.y, 0.5);
-    }
-  }
-
-  offset.x = AddDimensions(offset.x, position.x, interface.WindowArea().width);
-  offset.y = AddDimensions(offset.y, position.y, interface.WindowArea().height);
+  Point offset = AnchorPosition(
+      position, area_, control_area,
+      horizontal_alignment_, vertical_alignment_, interface.WindowArea());
 
   control_.value()->Update(offset, interface);
 }
@@ -132,32 +145,9 @@ void Anchor<T>::Display(const Point& position, Interface& interface) {
   }
 
   ::band::Area control_area = control_.value()->Area(interface);
-  Point offset{};
-
-  if (horizontal_alignment_ == Alignment::kMiddle ||
-      horizontal_alignment_ == Alignment::kBottom) {
-    offset.x = SubtractDimensions(
-        area_.width, control_area.width,
-        interface.WindowArea().width);
-
-    if (horizontal_alignment_ == Alignment::kMiddle) {
-      offset.x = MultiplyDimension(offset.x, 0.5);
-    }
-  }
-
-  if (vertical_alignment_ == Alignment::kMiddle ||
-      vertical_alignment_ == Alignment::kBottom) {
-    offset.y = SubtractDimensions(
-        area_.height, control_area.height,
-        interface.WindowArea().height);
-
-    if (vertical_alignment_ == Alignment::kMiddle) {
-      offset.y = MultiplyDimension(offset.y, 0.5);
-    }
-  }
-
-  offset.x = AddDimensions(offset.x, position.x, interface.WindowArea().width);
-  offset.y = AddDimensions(offset.y, position.y, interface.WindowArea().height);
+  Point offset = AnchorPosition(
+      position, area_, control_area,
+      horizontal_alignment_, vertical_alignment_, interface.WindowArea());
 
   control_.value()->Display(offset, interface);
 }
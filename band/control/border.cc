@@ -2,8 +2,6 @@
 
 #include <cmath>
 
-#include "band/control/rectangle.h"
-
 namespace band {
 namespace control {
 
@@ -42,41 +40,30 @@ Real Border::RealBorderThickness(const Interface& interface) const {
 void Border::Update(const Point&, const Interface&) { }
 
 void Border::Display(const Point& position, Interface& interface) {
-  Dimension thickness{};
-  thickness.scalar = RealBorderThickness(interface);
-  thickness.unit = Unit::kPixel;
+  // A border without thickness would be filled.
+  if (RealBorderThickness(interface) <= 0.0) {
+    return;
+  }
 
   ::band::Area area = this->Area(interface);
 
-  ::band::Area horizontal_area{ .width = area.width, .height = thickness };
-  ::band::Area vertical_area{ .width = thickness, .height = area.height };
-
-  ::band::control::Rectangle vertical;
-  vertical.SetColor(this->Color());
-  vertical.SetArea(vertical_area);
-
-  ::band::control::Rectangle horizontal;
-  horizontal.SetColor(this->Color());
-  horizontal.SetArea(horizontal_area);
-
-  Point top_left = position;
+  Point bottom_left = position;
   Point top_right{
-    .x = SubtractDimensions(
-        AddDimensions(top_left.x, area.width, interface.WindowArea().width),
-        thickness, interface.WindowArea().width),
-    .y = top_left.y
-  };
-  Point bottom_left{
-    .x = top_left.x,
-    .y = SubtractDimensions(
-        AddDimensions(top_left.y, area.height, interface.WindowArea().height),
-        thickness, interface.WindowArea().height)
+    .x = AddDimensions(
+        bottom_left.x, area.width,
+        interface.WindowArea().width),
+    .y = AddDimensions(
+        bottom_left.y, area.height,
+        interface.WindowArea().height)
   };
 
-  vertical.Display(top_left, interface);
-  horizontal.Display(top_left, interface);
-  vertical.Display(top_right, interface);
-  horizontal.Display(bottom_left, interface);
+  interface.DrawBox(Box{
+      .rectangle = ::band::Rectangle{
+        .bottom_left = bottom_left,
+        .top_right = top_right
+      },
+      .color = this->Color(),
+      .thickness = thickness_ });
 }
 
 }  // namespace control
@@ -1,11 +1,11 @@
 #pragma once
 
 #include <optional>
+#include <utility>
 
 #include "band/control.h"
 #include "band/control/anchor.h"
-#include "band/control/border.h"
-#include "band/control/rectangle.h"
+#include "band/control/style.h"
 #include "band/interface.h"
 
 namespace band {
@@ -13,14 +13,22 @@ namespace control {
 
 // Button that can be pressed.
 //
-// The button can have different colors based on the button state. The
-// last-action is updated after update calls and can be used to determine if the
-// button received an input.
+// The button can have different colors based on the button state which come
+// from its shared style. Setting a field of the style copies it into a style
+// owned by the button first so buttons sharing the style aren't changed. The
+// last-action is updated after update calls and can
+// be used to determine if the button received an input.
 template <typename T>
 class Button : public Control {
   public:
     enum class Action { kNone, kPress, kHover };
 
+    // Style that the button is drawn with.
+    //
+    // The default style is used if the style is nullptr.
+    const ButtonStyle& Style() const;
+    void SetStyle(const ButtonStyle* style);
+
     Color FillColor() const;
     void SetFillColor(const Color& color);
 
@@ -67,15 +75,7 @@ class Button : public Control {
     void Display(const Point& position, Interface& interface) override;
 
   private:
-    Color fill_color_{};
-    Color hover_color_{};
-    Color disabled_color_{};
-    Color border_color_{};
-
-    Alignment horizontal_alignment_{};
-    Alignment vertical_alignment_{};
-
-    Dimension border_thickness_{};
+    StylePointer<ButtonStyle> style_{};
 
     bool is_enabled_ = true;
 
@@ -94,74 +94,89 @@ class Button : public Control {
 namespace band {
 namespace control {
 
+template <typename T>
+const ButtonStyle& Button<T>::Style() const {
+  const ButtonStyle* style = style_.Get();
+  if (style == nullptr) {
+    return DefaultButtonStyle();
+  }
+
+  return *style;
+}
+
+template <typename T>
+void Button<T>::SetStyle(const ButtonStyle* style) {
+  style_.Share(style);
+}
+
 template <typename T>
 Color Button<T>::FillColor() const {
-  return fill_color_;
+  return Style().fill_color;
 }
 
 template <typename T>
 void Button<T>::SetFillColor(const Color& color) {
-  fill_color_ = color;
+  style_.Own(Style()).fill_color = color;
 }
 
 template <typename T>
 Color Button<T>::HoverColor() const {
-  return hover_color_;
+  return Style().hover_color;
 }
 
 template <typename T>
 void Button<T>::SetHoverColor(const Color& color) {
-  hover_color_ = color;
+  style_.Own(Style()).hover_color = color;
 }
 
 template <typename T>
 Color Button<T>::DisabledColor() const {
-  return disabled_color_;
+  return Style().disabled_color;
 }
 
 template <typename T>
 void Button<T>::SetDisabledColor(const Color& color) {
-  disabled_color_ = color;
+  style_.Own(Style()).disabled_color = color;
 }
 
 template <typename T>
 Color Button<T>::BorderColor() const {
-  return border_color_;
+  return Style().border_color;
 }
 
 template <typename T>
 void Button<T>::SetBorderColor(const Color& color) {
-  border_color_ = color;
+  style_.Own(Style()).border_color = color;
 }
 
 template <typename T>
 Alignment Button<T>::HorizontalAlignment() const {
-  return horizontal_alignment_;
+  return Style().horizontal_alignment;
 }
 
 template <typename T>
 void Button<T>::SetHorizontalAlignment(const Alignment& alignment) {
-  horizontal_alignment_ = alignment;
+  style_.Own(Style()).horizontal_alignment = alignment;
 }
 
 template <typename T>
 Alignment Button<T>::VerticalAlignment() const {
-  return vertical_alignment_;
+  return Style().vertical_alignment;
 }
 
 template <typename T>
 void Button<T>::SetVerticalAlignment(const Alignment& alignment) {
-  vertical_alignment_ = alignment;
+  style_.Own(Style()).vertical_alignment = alignment;
 }
 
 template <typename T>
 Dimension Button<T>::BorderThickness() const {
-  return border_thickness_;
+  return Style().border_thickness;
 }
 
 template <typename T>
 void Button<T>::SetBorderThickness(const Dimension& border_thickness) {
-  border_thickness_ = border_thickness;
+  style_.Own(Style()).border_thickness = border_thickness;
 }
 
 template <typename T>
@@ -186,7 +201,7 @@ void Button<T>::SetArea(const std::optional<::band::Area>& area) {
 
 template <typename T>
 void Button<T>::SetControl(T control) {
-  control_ = control;
+  control_ = std::move(control);
 }
 
 template <typename T>
@@ -241,41 +256,53 @@ void Button<T>::Update(
 template <typename T>
 void Button<T>::Display(const Point& position, Interface& interface) {
   ::band::Area area = Area(interface);
+  const ButtonStyle& style = Style();
 
-  Rectangle rectangle{};
-  rectangle.SetArea(area);
-
+  Color fill_color = style.disabled_color;
   if (is_enabled_) {
     switch (last_action_) {
     case Action::kNone:
-      rectangle.SetColor(fill_color_);
+      fill_color = style.fill_color;
       break;
     case Action::kHover:
     case Action::kPress:
     default:
-      rectangle.SetColor(hover_color_);
+      fill_color = style.hover_color;
       break;
     }
-  } else {
-    rectangle.SetColor(disabled_color_);
   }
 
-  Border border{};
-  border.SetArea(area);
-  border.SetThickness(border_thickness_);
-  border.SetColor(border_color_);
-
-  Anchor<T> anchor{};
-  anchor.SetHorizontalAlignment(horizontal_alignment_);
-  anchor.SetVerticalAlignment(vertical_alignment_);
-  anchor.SetReferenceArea(area);
-  if (control_.has_value()) {
-    anchor.SetControl(control_.value());
+  ::band::Rectangle rectangle{
+    .bottom_left = position,
+    .top_right = Point{
+      .x = AddDimensions(position.x, area.width, interface.WindowArea().width),
+      .y = AddDimensions(
+          position.y, area.height, interface.WindowArea().height)
+    }
+  };
+
+  // The fill and border are boxes so they're batched with every other
+  // button's.
+  interface.DrawBox(Box{
+      .rectangle = rectangle, .color = fill_color, .thickness = {} });
+  if (style.border_thickness.scalar > 0.0) {
+    interface.DrawBox(Box{
+        .rectangle = rectangle,
+        .color = style.border_color,
+        .thickness = style.border_thickness });
+  }
+
+  if (!control_.has_value()) {
+    return;
   }
 
-  rectangle.Display(position, interface);
-  border.Display(position, interface);
-  anchor.Display(position, interface);
+  Control& control = *control_.value();
+  control.Display(
+      AnchorPosition(
+          position, area, control.Area(interface),
+          style.horizontal_alignment, style.vertical_alignment,
+          interface.WindowArea()),
+      interface);
 }
 
 }  // namespace control
@@ -1,25 +1,41 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <initializer_list>
+#include <type_traits>
 #include <utility>
-#include <vector>
 
 #include "band/control.h"
+#include "band/control/small_vector.h"
 #include "band/interface.h"
 
 namespace band {
 namespace control {
 
 // FixedPanel displays controls in a single control as arranged.
+//
+// Controls are stored like they are in stack-panels.
 template <typename T>
 class FixedPanel : public Control {
   public:
+    // Controls stored in the panel before the heap is used.
+    static constexpr size_t kInlineControls = 4u;
+
     template <typename Iter>
     void SetControls(const Iter& begin, const Iter& end);
 
     void SetControls(const std::initializer_list<std::pair<T, Point>>& controls);
 
+    // SetControls to the controls in the range which are moved if the range is
+    // an rvalue.
+    template <typename Range>
+    void SetControls(Range&& controls);
+
+    void ClearControls();
+
+    void AddControl(T control, const Point& position);
+
     // Area is the measured area bounding all of the controls.
     ::band::Area Area(const Interface& interface) const override;
 
@@ -28,7 +44,7 @@ class FixedPanel : public Control {
     void Display(const Point& position, Interface& interface) override;
 
   private:
-    std::vector<std::pair<T, Point>> controls_{};
+    SmallVector<std::pair<T, Point>, kInlineControls> controls_{};
 
 };
 
@@ -42,23 +58,46 @@ namespace control {
 template <typename T>
 template <typename Iter>
 void FixedPanel<T>::SetControls(const Iter& begin, const Iter& end) {
-  controls_ = std::vector<std::pair<T, Point>>{begin, end};
+  controls_.Clear();
+  for (Iter it = begin; it != end; ++it) {
+    controls_.PushBack(*it);
+  }
 }
 
 template <typename T>
 void FixedPanel<T>::SetControls(
     const std::initializer_list<std::pair<T, Point>>& controls) {
-  controls_ = std::vector<std::pair<T, Point>>{controls};
+  SetControls(controls.begin(), controls.end());
+}
+
+template <typename T>
+template <typename Range>
+void FixedPanel<T>::SetControls(Range&& controls) {
+  controls_.Clear();
+  for (auto& control : controls) {
+    if constexpr (std::is_rvalue_reference_v<Range&&>) {
+      controls_.PushBack(std::move(control));
+    } else {
+      controls_.PushBack(control);
+    }
+  }
+}
+
+template <typename T>
+void FixedPanel<T>::ClearControls() {
+  controls_.Clear();
+}
+
+template <typename T>
+void FixedPanel<T>::AddControl(T control, const Point& position) {
+  controls_.PushBack(std::pair<T, Point>{std::move(control), position});
 }
 
 template <typename T>
 ::band::Area FixedPanel<T>::Area(const Interface& interface) const {
   ::band::Area current_area{};
 
-  for (
-      typename decltype(controls_)::size_type i = 0u;
-      i < controls_.size();
-      i++) {
+  for (size_t i = 0u; i < controls_.Size(); i++) {
     ::band::Area control_area = controls_[i].first->Area(interface);
 
     Dimension right_extent = controls_[i].second.x;
@@ -84,10 +123,7 @@ template <typename T>
 
 template <typename T>
 void FixedPanel<T>::Update(const Point& position, const Interface& interface) {
-  for (
-      typename decltype(controls_)::size_type i = 0u;
-      i < controls_.size();
-      i++) {
+  for (size_t i = 0u; i < controls_.Size(); i++) {
     Point control_position = position;
     control_position.x = AddDimensions(
         control_position.x, controls_[i].second.x,
@@ -102,10 +138,7 @@ void FixedPanel<T>::Update(const Point& position, const Interface& interface) {
 
 template <typename T>
 void FixedPanel<T>::Display(const Point& position, Interface& interface) {
-  for (
-      typename decltype(controls_)::size_type i = 0u;
-      i < controls_.size();
-      i++) {
+  for (size_t i = 0u; i < controls_.Size(); i++) {
     Point control_position = position;
     control_position.x = AddDimensions(
         control_position.x, controls_[i].second.x,
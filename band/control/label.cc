@@ -11,40 +11,54 @@ void Label::SetText(const ::band::Text& text) {
   text_ = text;
 }
 
+const TextStyle& Label::Style() const {
+  const TextStyle* style = style_.Get();
+  if (style == nullptr) {
+    return DefaultTextStyle();
+  }
+
+  return *style;
+}
+
+void Label::SetStyle(const TextStyle* style) {
+  style_.Share(style);
+}
+
 Dimension Label::FontSize() const {
-  return font_size_;
+  return Style().font_size;
 }
 
 void Label::SetFontSize(const Dimension& font_size) {
-  font_size_ = font_size;
+  style_.Own(Style()).font_size = font_size;
 }
 
 Color Label::FontColor() const {
-  return font_color_;
+  return Style().font_color;
 }
 
 void Label::SetFontColor(const Color& font_color) {
-  font_color_ = font_color;
+  style_.Own(Style()).font_color = font_color;
 }
 
 ::band::FontId Label::FontId() const {
-  return font_id_;
+  return Style().font_id;
 }
 
 void Label::SetFontId(::band::FontId font_id) {
-  font_id_ = font_id;
+  style_.Own(Style()).font_id = font_id;
 }
 
 ::band::Area Label::Area(const Interface& interface) const {
-  return interface.MeasureText(text_, this->FontSize(), this->FontId());
+  const TextStyle& style = Style();
+  return interface.MeasureText(text_, style.font_size, style.font_id);
 }
 
 void Label::Update(const Point&, const Interface&) { }
 
 void Label::Display(const Point& position, Interface& interface) {
+  const TextStyle& style = Style();
   interface.DrawText(
-      text_, position,
-      this->FontSize(), this->FontColor(), this->FontId());
+      text_, position, style.font_size, style.font_color, style.font_id);
 }
 
 }  // namespace control
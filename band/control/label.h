@@ -1,17 +1,28 @@
 #pragma once
 
 #include "band/control.h"
+#include "band/control/style.h"
 #include "band/interface.h"
 
 namespace band {
 namespace control {
 
 // Label is a control that displays text.
+//
+// The label only stores its text and points to its shared style. Setting a
+// field of the style copies it into a style owned by the label first so labels
+// sharing the style aren't changed.
 class Label : public Control {
   public:
     ::band::Text Text() const;
     void SetText(const ::band::Text& text);
 
+    // Style that the label is drawn with.
+    //
+    // The default style is used if the style is nullptr.
+    const TextStyle& Style() const;
+    void SetStyle(const TextStyle* style);
+
     Dimension FontSize() const;
     void SetFontSize(const Dimension& font_size);
 
@@ -30,9 +41,7 @@ class Label : public Control {
 
   private:
     ::band::Text text_{};
-    Dimension font_size_{};
-    Color font_color_{};
-    ::band::FontId font_id_{};
+    StylePointer<TextStyle> style_{};
 
 };
 
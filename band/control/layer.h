@@ -0,0 +1,172 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "band/control.h"
+#include "band/control/texture.h"
+#include "band/interface.h"
+#include "band/interface/hash.h"
+#include "band/interface/hashing_interface.h"
+
+namespace band {
+namespace control {
+
+// Layer displays the control from a captured texture once the control stops
+// changing.
+//
+// What the control would draw is hashed without drawing it. The layer is
+// promoted to a texture once the hash has been the same for a while and the
+// texture is recaptured whenever the hash changes. A promoted layer changing
+// again soon after it was captured is demoted back to displaying the control
+// directly so churning controls aren't recaptured every frame.
+//
+// Promoted layers hash the control every display. Layers that aren't promoted
+// already display the control so they only hash it every few displays.
+//
+// Controls in layers shouldn't select textures or load resources while they're
+// displayed. Textures drawn by the control are hashed with their versions so
+// drawing on them changes the hash.
+template <typename T>
+class Layer : public Control {
+  public:
+    // Displays the hash is the same for before the layer is promoted.
+    static constexpr Size kPromoteDisplays = 30u;
+    // Displays within which the hash changing again demotes the layer.
+    static constexpr Size kDemoteDisplays = 60u;
+    // Displays between hashes while the layer isn't promoted.
+    static constexpr Size kHashDisplays = 5u;
+
+    void SetControl(T control);
+
+    // CleanUp the captured texture.
+    void CleanUp(Interface& interface);
+
+    bool IsPromoted() const;
+
+    ::band::Area Area(const Interface& interface) const override;
+
+    void Update(const Point& position, const Interface& interface) override;
+
+    void Display(const Point& position, Interface& interface) override;
+
+  private:
+    std::optional<T> control_ = std::nullopt;
+
+    Texture texture_{};
+
+    std::optional<uint64_t> hash_ = std::nullopt;
+    std::optional<uint64_t> captured_hash_ = std::nullopt;
+    Size unchanged_displays_ = 0u;
+    Size unhashed_displays_ = 0u;
+    bool is_promoted_ = false;
+
+};
+
+}  // namespace control
+}  // namespace band
+
+namespace band {
+namespace control {
+
+template <typename T>
+void Layer<T>::SetControl(T control) {
+  control_ = std::move(control);
+  hash_ = std::nullopt;
+  captured_hash_ = std::nullopt;
+  unchanged_displays_ = 0u;
+  unhashed_displays_ = 0u;
+  is_promoted_ = false;
+}
+
+template <typename T>
+void Layer<T>::CleanUp(Interface& interface) {
+  texture_.CleanUp(interface);
+  captured_hash_ = std::nullopt;
+}
+
+template <typename T>
+bool Layer<T>::IsPromoted() const {
+  return is_promoted_;
+}
+
+template <typename T>
+::band::Area Layer<T>::Area(const Interface& interface) const {
+  if (!control_.has_value()) {
+    return ::band::Area{};
+  }
+
+  return control_.value()->Area(interface);
+}
+
+template <typename T>
+void Layer<T>::Update(const Point& position, const Interface& interface) {
+  if (!control_.has_value()) {
+    return;
+  }
+
+  control_.value()->Update(position, interface);
+}
+
+template <typename T>
+void Layer<T>::Display(const Point& position, Interface& interface) {
+  if (!control_.has_value()) {
+    return;
+  }
+
+  Control& control = *control_.value();
+
+  unhashed_displays_++;
+  if (!is_promoted_ && hash_.has_value() &&
+      unhashed_displays_ < kHashDisplays) {
+    control.Display(position, interface);
+    return;
+  }
+
+  Size displays = unhashed_displays_;
+  unhashed_displays_ = 0u;
+
+  // The control is hashed where it would be captured so moving the layer
+  // doesn't change the hash.
+  ::band::interface::HashingInterface hashing{interface};
+  control.Display(Point{}, hashing);
+
+  uint64_t hash = ::band::interface::Hash(
+      hashing.DrawnHash(), control.Area(interface), interface.WindowArea());
+  bool is_changed = hashing.IsVolatile() ||
+    !hash_.has_value() || hash_.value() != hash;
+  hash_ = hash;
+
+  if (is_changed) {
+    if (is_promoted_ && unchanged_displays_ < kDemoteDisplays) {
+      is_promoted_ = false;
+      CleanUp(interface);
+    }
+
+    unchanged_displays_ = 0u;
+  } else {
+    unchanged_displays_ =
+      std::min(unchanged_displays_ + displays, kDemoteDisplays);
+  }
+
+  if (!is_promoted_ && unchanged_displays_ >= kPromoteDisplays) {
+    is_promoted_ = true;
+  }
+
+  if (!is_promoted_) {
+    control.Display(position, interface);
+    return;
+  }
+
+  if (!captured_hash_.has_value() || captured_hash_.value() != hash) {
+    texture_.CaptureControl(interface, control);
+    captured_hash_ = hash;
+  }
+
+  texture_.Display(position, interface);
+}
+
+}  // namespace control
+}  // namespace band
@@ -0,0 +1,198 @@
+#include "band/control/perf_hud.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+namespace band {
+namespace control {
+
+namespace {
+
+// Fraction of the HUD's height taken by the graph.
+constexpr Real kGraphHeight = 0.5;
+
+// Milliseconds of the seconds.
+Real Milliseconds(Real seconds) {
+  return seconds * 1000.0;
+}
+
+Size DrawCalls(const FrameStats::DrawCalls& draw_calls) {
+  return draw_calls.clears + draw_calls.textures + draw_calls.sprites +
+    draw_calls.lines + draw_calls.circles + draw_calls.rectangles +
+    draw_calls.triangles + draw_calls.texts;
+}
+
+uint64_t ResidentBytes(const FrameStats::ResidentBytes& resident_bytes) {
+  return resident_bytes.images + resident_bytes.atlas_pages +
+    resident_bytes.render_targets + resident_bytes.fonts +
+    resident_bytes.pooled;
+}
+
+}  // namespace
+
+void PerfHud::SetArea(const ::band::Area& area) {
+  area_ = area;
+}
+
+const TextStyle& PerfHud::Style() const {
+  if (style_ == nullptr) {
+    return DefaultTextStyle();
+  }
+
+  return *style_;
+}
+
+void PerfHud::SetStyle(const TextStyle* style) {
+  style_ = style;
+}
+
+void PerfHud::SetBackgroundColor(const Color& color) {
+  background_color_ = color;
+}
+
+void PerfHud::SetGraphColor(const Color& color) {
+  graph_color_ = color;
+}
+
+Real PerfHud::Percentile(Real percentile) const {
+  if (frames_ == 0u) {
+    return 0.0;
+  }
+
+  std::array<Real, kFrames> sorted = frame_seconds_;
+  size_t rank = static_cast<size_t>(std::ceil(percentile * frames_));
+  size_t index = std::clamp<size_t>(rank, 1u, frames_) - 1u;
+
+  std::nth_element(
+      sorted.begin(), sorted.begin() + index, sorted.begin() + frames_);
+
+  return sorted[index];
+}
+
+::band::Area PerfHud::Area(const Interface&) const {
+  return area_;
+}
+
+void PerfHud::Update(const Point&, const Interface& interface) {
+  uint64_t frame = interface.Frame().Index();
+  if (sampled_frame_.has_value() && sampled_frame_.value() == frame) {
+    return;
+  }
+  sampled_frame_ = frame;
+
+  stats_ = interface.Stats();
+
+  frame_seconds_[next_] = stats_.frame_seconds;
+  next_ = (next_ + 1u) % kFrames;
+  frames_ = std::min(frames_ + 1u, kFrames);
+}
+
+void PerfHud::Display(const Point& position, Interface& interface) {
+  ::band::WindowArea window_area = interface.WindowArea();
+
+  // The HUD stays readable while the resolution is lowered.
+  interface.StartOverlay();
+
+  Dimension graph_height = MultiplyDimension(area_.height, kGraphHeight);
+  Dimension graph_bottom = AddDimensions(
+      position.y, graph_height, window_area.height);
+
+  // Bars are scaled so the slowest frame fills the graph.
+  Real slowest = 0.0;
+  for (Size i = 0u; i < frames_; i++) {
+    slowest = std::max(slowest, frame_seconds_[i]);
+  }
+
+  // The background is the first rectangle so the bars are drawn over it in
+  // the same draw.
+  Size bars = slowest > 0.0 ? frames_ : 0u;
+  ::band::Rectangle* rectangles =
+    interface.Frame().Arena().CreateArray<::band::Rectangle>(bars + 1u);
+  Color* colors = interface.Frame().Arena().CreateArray<Color>(bars + 1u);
+
+  rectangles[0] = ::band::Rectangle{
+    .bottom_left = position,
+    .top_right = Point{
+      .x = AddDimensions(position.x, area_.width, window_area.width),
+      .y = AddDimensions(position.y, area_.height, window_area.height)
+    }
+  };
+  colors[0] = background_color_;
+
+  // The oldest frame is on the left.
+  Size oldest = frames_ < kFrames ? 0u : next_;
+  for (Size i = 0u; i < bars; i++) {
+    Real seconds = frame_seconds_[(oldest + i) % kFrames];
+
+    rectangles[i + 1u] = ::band::Rectangle{
+      .bottom_left = Point{
+        .x = AddDimensions(
+            position.x,
+            MultiplyDimension(area_.width, static_cast<Real>(i) / kFrames),
+            window_area.width),
+        .y = SubtractDimensions(
+            graph_bottom,
+            MultiplyDimension(graph_height, seconds / slowest),
+            window_area.height)
+      },
+      .top_right = Point{
+        .x = AddDimensions(
+            position.x,
+            MultiplyDimension(
+              area_.width, static_cast<Real>(i + 1u) / kFrames),
+            window_area.width),
+        .y = graph_bottom
+      }
+    };
+    colors[i + 1u] = graph_color_;
+  }
+
+  interface.DrawRectangles(
+      Span<::band::Rectangle>{ .values = rectangles, .n = bars + 1u },
+      Span<Color>{ .values = colors, .n = bars + 1u });
+
+  char text[256];
+  int n = std::snprintf(
+      text, sizeof(text),
+      "frame %.1f ms p50 %.1f p95 %.1f p99 %.1f\n"
+      "update %.1f display %.1f present %.1f ms\n"
+      "draws %u binds %u targets %u\n"
+      "textures %.1f MiB",
+      Milliseconds(stats_.frame_seconds),
+      Milliseconds(Percentile(0.5)),
+      Milliseconds(Percentile(0.95)),
+      Milliseconds(Percentile(0.99)),
+      Milliseconds(stats_.update_seconds),
+      Milliseconds(stats_.display_seconds),
+      Milliseconds(stats_.present_seconds),
+      DrawCalls(stats_.draw_calls),
+      stats_.texture_binds,
+      stats_.target_switches,
+      ResidentBytes(stats_.resident_bytes) / (1024.0 * 1024.0));
+  if (stats_.allocations.has_value() && n > 0 &&
+      static_cast<size_t>(n) < sizeof(text)) {
+    n += std::snprintf(
+        text + n, sizeof(text) - n,
+        " allocations %u", stats_.allocations.value());
+  }
+  if (stats_.resolution_scale < 1.0 && n > 0 &&
+      static_cast<size_t>(n) < sizeof(text)) {
+    std::snprintf(
+        text + n, sizeof(text) - n,
+        " scale %.0f%%", stats_.resolution_scale * 100.0);
+  }
+  text_.assign(text);
+
+  const TextStyle& style = Style();
+  interface.DrawText(
+      text_,
+      Point{ .x = position.x, .y = graph_bottom },
+      style.font_size, style.font_color, style.font_id);
+
+  interface.StopOverlay();
+}
+
+}  // namespace control
+}  // namespace band
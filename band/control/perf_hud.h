@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+#include "band/control.h"
+#include "band/control/style.h"
+#include "band/interface.h"
+
+namespace band {
+namespace control {
+
+// PerfHud displays what recent frames cost.
+//
+// A graph of recent frame-times is shown above the frame-time percentiles, the
+// time split between updating, displaying, and presenting, and the draw-calls
+// and texture memory of the last frame. The stats of the last frame are
+// sampled by the first update of each frame so updating several times a frame
+// doesn't sample a frame twice.
+//
+// The background and the graph's bars are drawn in a single bulk-draw and the
+// text in a single text-draw so the HUD barely changes what it measures.
+class PerfHud : public Control {
+  public:
+    // Frames shown in the graph and used for the percentiles.
+    static constexpr Size kFrames = 120u;
+
+    void SetArea(const ::band::Area& area);
+
+    // Style that the text is drawn with.
+    //
+    // The default style is used if the style is nullptr.
+    const TextStyle& Style() const;
+    void SetStyle(const TextStyle* style);
+
+    void SetBackgroundColor(const Color& color);
+    void SetGraphColor(const Color& color);
+
+    // Percentile of the sampled frame-times in seconds.
+    Real Percentile(Real percentile) const;
+
+    ::band::Area Area(const Interface& interface) const override;
+
+    void Update(const Point& position, const Interface& interface) override;
+
+    void Display(const Point& position, Interface& interface) override;
+
+  private:
+    ::band::Area area_{};
+    const TextStyle* style_ = nullptr;
+    Color background_color_{};
+    Color graph_color_{};
+
+    // Frame-times in seconds with the oldest at 'next_' once full.
+    std::array<Real, kFrames> frame_seconds_{};
+    Size frames_ = 0u;
+    Size next_ = 0u;
+
+    FrameStats stats_{};
+    // Frame the stats were last sampled in.
+    std::optional<uint64_t> sampled_frame_ = std::nullopt;
+
+    // Text is kept between displays so formatting it doesn't allocate.
+    ::band::Text text_{};
+
+};
+
+}  // namespace control
+}  // namespace band
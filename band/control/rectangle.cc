@@ -38,7 +38,10 @@ void Rectangle::Display(const Point& position, Interface& interface) {
     .top_right = top_right
   };
 
-  interface.DrawRectangle(rectangle, this->Color());
+  interface.DrawBox(Box{
+      .rectangle = rectangle,
+      .color = this->Color(),
+      .thickness = {} });
 }
 
 }  // namespace control
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace band {
+namespace control {
+
+// SmallVector stores up to N values inline and the rest on the heap.
+//
+// Clearing keeps the capacity so refilling a cleared vector only allocates if it
+// grows past every size it has been. Values only have to be movable and the
+// vector is only copyable if they're copyable.
+template <typename T, size_t N>
+class SmallVector {
+  private:
+    struct Uncopyable;
+
+    // CopySource is what the vector is copied from which can't be passed if
+    // the values aren't copyable. The copy operations are then implicitly
+    // deleted since the vector has move operations.
+    using CopySource = std::conditional_t<
+      std::is_copy_constructible<T>::value, SmallVector, Uncopyable>;
+
+  public:
+    static_assert(N > 0u, "small-vectors store at least one value inline");
+
+    SmallVector() = default;
+
+    SmallVector(const CopySource& other);
+    SmallVector& operator=(const CopySource& other);
+    SmallVector(SmallVector&& other) noexcept;
+    SmallVector& operator=(SmallVector&& other) noexcept;
+
+    ~SmallVector();
+
+    size_t Size() const;
+
+    // IsInline returns if the values are stored in the vector instead of the
+    // heap.
+    bool IsInline() const;
+
+    // Reserve room for at least n values.
+    void Reserve(size_t n);
+
+    void PushBack(T value);
+
+    // Clear the values while keeping the capacity.
+    void Clear();
+
+    T& operator[](size_t i);
+    const T& operator[](size_t i) const;
+
+    T* begin();
+    T* end();
+    const T* begin() const;
+    const T* end() const;
+
+  private:
+    T* InlineValues();
+
+    // Steal the values of the other vector into this empty vector.
+    void Steal(SmallVector& other);
+
+    // Release the values and heap storage.
+    void Release();
+
+    alignas(T) unsigned char inline_[sizeof(T) * N];
+
+    T* values_ = InlineValues();
+    size_t n_ = 0u;
+    size_t capacity_ = N;
+};
+
+}  // namespace control
+}  // namespace band
+
+namespace band {
+namespace control {
+
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(const CopySource& other) {
+  Reserve(other.n_);
+  for (size_t i = 0u; i < other.n_; i++) {
+    PushBack(other[i]);
+  }
+}
+
+template <typename T, size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(const CopySource& other) {
+  if (this == &other) {
+    return *this;
+  }
+
+  Clear();
+  Reserve(other.n_);
+  for (size_t i = 0u; i < other.n_; i++) {
+    PushBack(other[i]);
+  }
+
+  return *this;
+}
+
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(SmallVector&& other) noexcept {
+  Steal(other);
+}
+
+template <typename T, size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+
+  Release();
+  Steal(other);
+
+  return *this;
+}
+
+template <typename T, size_t N>
+SmallVector<T, N>::~SmallVector() {
+  Release();
+}
+
+template <typename T, size_t N>
+size_t SmallVector<T, N>::Size() const {
+  return n_;
+}
+
+template <typename T, size_t N>
+bool SmallVector<T, N>::IsInline() const {
+  return capacity_ == N;
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::Reserve(size_t n) {
+  if (n <= capacity_) {
+    return;
+  }
+
+  size_t capacity = capacity_ * 2u;
+  if (capacity < n) {
+    capacity = n;
+  }
+
+  T* values = static_cast<T*>(::operator new(sizeof(T) * capacity));
+  for (size_t i = 0u; i < n_; i++) {
+    new (values + i) T(std::move(values_[i]));
+    values_[i].~T();
+  }
+
+  if (!IsInline()) {
+    ::operator delete(values_);
+  }
+
+  values_ = values;
+  capacity_ = capacity;
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::PushBack(T value) {
+  Reserve(n_ + 1u);
+  new (values_ + n_) T(std::move(value));
+  n_++;
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::Clear() {
+  for (size_t i = 0u; i < n_; i++) {
+    values_[i].~T();
+  }
+
+  n_ = 0u;
+}
+
+template <typename T, size_t N>
+T& SmallVector<T, N>::operator[](size_t i) {
+  return values_[i];
+}
+
+template <typename T, size_t N>
+const T& SmallVector<T, N>::operator[](size_t i) const {
+  return values_[i];
+}
+
+template <typename T, size_t N>
+T* SmallVector<T, N>::begin() {
+  return values_;
+}
+
+template <typename T, size_t N>
+T* SmallVector<T, N>::end() {
+  return values_ + n_;
+}
+
+template <typename T, size_t N>
+const T* SmallVector<T, N>::begin() const {
+  return values_;
+}
+
+template <typename T, size_t N>
+const T* SmallVector<T, N>::end() const {
+  return values_ + n_;
+}
+
+template <typename T, size_t N>
+T* SmallVector<T, N>::InlineValues() {
+  return reinterpret_cast<T*>(inline_);
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::Steal(SmallVector& other) {
+  if (other.IsInline()) {
+    values_ = InlineValues();
+    capacity_ = N;
+    for (size_t i = 0u; i < other.n_; i++) {
+      new (values_ + i) T(std::move(other.values_[i]));
+    }
+    n_ = other.n_;
+    other.Clear();
+    return;
+  }
+
+  values_ = other.values_;
+  n_ = other.n_;
+  capacity_ = other.capacity_;
+
+  other.values_ = other.InlineValues();
+  other.n_ = 0u;
+  other.capacity_ = N;
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::Release() {
+  Clear();
+
+  if (!IsInline()) {
+    ::operator delete(values_);
+  }
+
+  values_ = InlineValues();
+  capacity_ = N;
+}
+
+}  // namespace control
+}  // namespace band
@@ -0,0 +1,37 @@
+#include "band/control/sprite_sheet.h"
+
+namespace band {
+namespace control {
+
+void SpriteSheet::SetSprites(const std::initializer_list<Sprite>& sprites) {
+  sprites_.assign(sprites);
+}
+
+::band::Area SpriteSheet::Area(const Interface& interface) const {
+  ::band::Area current_area{};
+
+  for (const Sprite& sprite : sprites_) {
+    current_area.width = MaxDimension(
+        current_area.width, sprite.destination.top_right.x,
+        interface.WindowArea().width);
+    current_area.height = MaxDimension(
+        current_area.height, sprite.destination.top_right.y,
+        interface.WindowArea().height);
+  }
+
+  return current_area;
+}
+
+void SpriteSheet::Display(const Point& position, Interface& interface) {
+  std::optional<TextureId> id = Id();
+  if (!id.has_value()) {
+    return;
+  }
+
+  interface.DrawSprites(
+      id.value(), position,
+      Span<Sprite>{ .values = sprites_.data(), .n = sprites_.size() });
+}
+
+}  // namespace control
+}  // namespace band
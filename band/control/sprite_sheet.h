@@ -0,0 +1,47 @@
+#pragma once
+
+#include <initializer_list>
+#include <vector>
+
+#include "band/control.h"
+#include "band/control/texture.h"
+#include "band/interface.h"
+
+namespace band {
+namespace control {
+
+// SpriteSheet displays sprites from its captured texture in a single batch.
+//
+// The texture is typically an atlas of many sub-images. Destinations of the
+// sprites are relative to the sheet's position.
+class SpriteSheet : public Texture {
+  public:
+    template <typename Iter>
+    void SetSprites(const Iter& begin, const Iter& end);
+
+    void SetSprites(const std::initializer_list<Sprite>& sprites);
+
+    // Area is the measured area bounding all of the sprites.
+    ::band::Area Area(const Interface& interface) const override;
+
+    void Display(const Point& position, Interface& interface) override;
+
+  private:
+    std::vector<Sprite> sprites_{};
+
+};
+
+
+}  // namespace control
+}  // namespace band
+
+namespace band {
+namespace control {
+
+template <typename Iter>
+void SpriteSheet::SetSprites(const Iter& begin, const Iter& end) {
+  sprites_.assign(begin, end);
+}
+
+}  // namespace control
+}  // namespace band
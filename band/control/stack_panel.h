@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <initializer_list>
-#include <vector>
+#include <type_traits>
+#include <utility>
 
 #include "band/control.h"
 #include "band/control/anchor.h"
+#include "band/control/small_vector.h"
 #include "band/interface.h"
 
 namespace band {
@@ -14,9 +17,15 @@ namespace control {
 // direction.
 //
 // The stacked controls can have an alignment with respect to the panel.
+//
+// Controls can be move-only like owning pointers. A few controls are stored in
+// the panel and setting controls again reuses the storage.
 template <typename T>
 class StackPanel : public Control {
   public:
+    // Controls stored in the panel before the heap is used.
+    static constexpr size_t kInlineControls = 4u;
+
     ::band::Alignment Alignment() const;
     void SetAlignment(const ::band::Alignment& alignment);
 
@@ -28,6 +37,15 @@ class StackPanel : public Control {
 
     void SetControls(const std::initializer_list<T>& controls);
 
+    // SetControls to the controls in the range which are moved if the range is
+    // an rvalue.
+    template <typename Range>
+    void SetControls(Range&& controls);
+
+    void ClearControls();
+
+    void AddControl(T control);
+
     // Area is the measured area of all the controls.
     ::band::Area Area(const Interface& interface) const override;
 
@@ -39,7 +57,7 @@ class StackPanel : public Control {
     ::band::Alignment alignment_{};
     ::band::Direction direction_{};
 
-    std::vector<T> controls_{};
+    SmallVector<T, kInlineControls> controls_{};
 
 };
 
@@ -73,12 +91,38 @@ void StackPanel<T>::SetDirection(const ::band::Direction& direction) {
 template <typename T>
 template <typename Iter>
 void StackPanel<T>::SetControls(const Iter& begin, const Iter& end) {
-  controls_ = std::vector<T>{begin, end};
+  controls_.Clear();
+  for (Iter it = begin; it != end; ++it) {
+    controls_.PushBack(*it);
+  }
 }
 
 template <typename T>
 void StackPanel<T>::SetControls(const std::initializer_list<T>& controls) {
-  controls_ = std::vector<T>{controls};
+  SetControls(controls.begin(), controls.end());
+}
+
+template <typename T>
+template <typename Range>
+void StackPanel<T>::SetControls(Range&& controls) {
+  controls_.Clear();
+  for (auto& control : controls) {
+    if constexpr (std::is_rvalue_reference_v<Range&&>) {
+      controls_.PushBack(std::move(control));
+    } else {
+      controls_.PushBack(control);
+    }
+  }
+}
+
+template <typename T>
+void StackPanel<T>::ClearControls() {
+  controls_.Clear();
+}
+
+template <typename T>
+void StackPanel<T>::AddControl(T control) {
+  controls_.PushBack(std::move(control));
 }
 
 template <typename T>
@@ -92,10 +136,7 @@ template <typename T>
     height_function = MaxDimension;
   }
 
-  for (
-      typename decltype(controls_)::size_type i = 0u;
-      i < controls_.size();
-      i++) {
+  for (size_t i = 0u; i < controls_.Size(); i++) {
     ::band::Area control_area = controls_[i]->Area(interface);
 
     current_area.width = width_function(
@@ -114,15 +155,9 @@ void StackPanel<T>::Update(const Point& position, const Interface& interface) {
   ::band::Area total_area = this->Area(interface);
   Point current_position = position;
 
-  for (
-      typename decltype(controls_)::size_type i = 0u;
-      i < controls_.size();
-      i++) {
+  for (size_t i = 0u; i < controls_.Size(); i++) {
     ::band::Area control_area = controls_[i]->Area(interface);
 
-    Anchor<T> anchor{};
-    anchor.SetHorizontalAlignment(alignment_);
-    anchor.SetVerticalAlignment(Alignment::kTop);
     ::band::Area reference_area{};
 
     if (direction_ == Direction::kVertical) {
@@ -133,10 +168,11 @@ void StackPanel<T>::Update(const Point& position, const Interface& interface) {
       reference_area.height = total_area.height;
     }
 
-    anchor.SetReferenceArea(reference_area);
-    anchor.SetControl(controls_[i]);
-
-    anchor.Update(current_position, interface);
+    controls_[i]->Update(
+        AnchorPosition(
+            current_position, reference_area, control_area,
+            alignment_, Alignment::kTop, interface.WindowArea()),
+        interface);
 
     if (direction_ == Direction::kVertical) {
       current_position.y = AddDimensions(
@@ -155,15 +191,9 @@ void StackPanel<T>::Display(const Point& position, Interface& interface) {
   ::band::Area total_area = this->Area(interface);
   Point current_position = position;
 
-  for (
-      typename decltype(controls_)::size_type i = 0u;
-      i < controls_.size();
-      i++) {
+  for (size_t i = 0u; i < controls_.Size(); i++) {
     ::band::Area control_area = controls_[i]->Area(interface);
 
-    Anchor<T> anchor;
-    anchor.SetHorizontalAlignment(alignment_);
-    anchor.SetVerticalAlignment(Alignment::kTop);
     ::band::Area reference_area{};
 
     if (direction_ == Direction::kVertical) {
@@ -174,10 +204,11 @@ void StackPanel<T>::Display(const Point& position, Interface& interface) {
       reference_area.height = total_area.height;
     }
 
-    anchor.SetReferenceArea(reference_area);
-    anchor.SetControl(controls_[i]);
-
-    anchor.Display(current_position, interface);
+    controls_[i]->Display(
+        AnchorPosition(
+            current_position, reference_area, control_area,
+            alignment_, Alignment::kTop, interface.WindowArea()),
+        interface);
 
     if (direction_ == Direction::kVertical) {
       current_position.y = AddDimensions(
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+#include "band/interface.h"
+
+namespace band {
+namespace control {
+
+// TextStyle is how text is drawn.
+//
+// Styles are shared between controls by pointer so controls that look the
+// same don't each store a copy. Styles must outlive the controls pointing to
+// them and shouldn't be changed while they're pointed to.
+struct TextStyle {
+  Dimension font_size;
+  Color font_color;
+  FontId font_id;
+};
+
+// ButtonStyle is how a button is drawn.
+//
+// Styles are shared like text-styles.
+struct ButtonStyle {
+  Color fill_color;
+  Color hover_color;
+  Color disabled_color;
+  Color border_color;
+
+  Alignment horizontal_alignment;
+  Alignment vertical_alignment;
+
+  Dimension border_thickness;
+};
+
+// StylePointer points to a shared style or a style it owns in a single pointer.
+//
+// Controls share styles until a single field is set, which copies the style
+// into one owned by the control. Owned styles are marked in the pointer's
+// lowest bit so controls that don't own their style don't pay for ownership.
+// Copies of a pointer owning its style own a copy of it.
+template <typename S>
+class StylePointer {
+  public:
+    static_assert(alignof(S) > 1u, "owned styles are marked in the low bit");
+
+    StylePointer() = default;
+
+    StylePointer(const StylePointer& other);
+    StylePointer& operator=(const StylePointer& other);
+    StylePointer(StylePointer&& other) noexcept;
+    StylePointer& operator=(StylePointer&& other) noexcept;
+
+    ~StylePointer();
+
+    // Get the style which is nullptr if there is none.
+    const S* Get() const;
+
+    // Share the style which isn't owned. Sharing the pointed to style does
+    // nothing.
+    void Share(const S* style);
+
+    // Own returns the owned style, copying the passed style into it first if
+    // the style isn't owned yet.
+    S& Own(const S& style);
+
+  private:
+    static constexpr uintptr_t kOwned = 1u;
+
+    bool IsOwned() const;
+
+    // Release the owned style.
+    void Release();
+
+    uintptr_t bits_ = 0u;
+};
+
+// DefaultTextStyle is used by controls without a text-style.
+inline const TextStyle& DefaultTextStyle() {
+  static const TextStyle style{};
+  return style;
+}
+
+// DefaultButtonStyle is used by controls without a button-style.
+inline const ButtonStyle& DefaultButtonStyle() {
+  static const ButtonStyle style{};
+  return style;
+}
+
+template <typename S>
+StylePointer<S>::StylePointer(const StylePointer& other) : bits_{other.bits_} {
+  if (other.IsOwned()) {
+    bits_ = reinterpret_cast<uintptr_t>(new S(*other.Get())) | kOwned;
+  }
+}
+
+template <typename S>
+StylePointer<S>& StylePointer<S>::operator=(const StylePointer& other) {
+  if (this == &other) {
+    return *this;
+  }
+
+  StylePointer copy{other};
+  *this = std::move(copy);
+
+  return *this;
+}
+
+template <typename S>
+StylePointer<S>::StylePointer(StylePointer&& other) noexcept :
+  bits_{other.bits_} {
+  other.bits_ = 0u;
+}
+
+template <typename S>
+StylePointer<S>& StylePointer<S>::operator=(StylePointer&& other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+
+  Release();
+  bits_ = other.bits_;
+  other.bits_ = 0u;
+
+  return *this;
+}
+
+template <typename S>
+StylePointer<S>::~StylePointer() {
+  Release();
+}
+
+template <typename S>
+const S* StylePointer<S>::Get() const {
+  return reinterpret_cast<const S*>(bits_ & ~kOwned);
+}
+
+template <typename S>
+void StylePointer<S>::Share(const S* style) {
+  if (style == Get()) {
+    return;
+  }
+
+  Release();
+  bits_ = reinterpret_cast<uintptr_t>(style);
+}
+
+template <typename S>
+S& StylePointer<S>::Own(const S& style) {
+  if (!IsOwned()) {
+    bits_ = reinterpret_cast<uintptr_t>(new S(style)) | kOwned;
+  }
+
+  return *reinterpret_cast<S*>(bits_ & ~kOwned);
+}
+
+template <typename S>
+bool StylePointer<S>::IsOwned() const {
+  return (bits_ & kOwned) != 0u;
+}
+
+template <typename S>
+void StylePointer<S>::Release() {
+  if (IsOwned()) {
+    delete Get();
+  }
+
+  bits_ = 0u;
+}
+
+}  // namespace control
+}  // namespace band
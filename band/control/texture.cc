@@ -20,6 +20,64 @@ void Texture::CaptureControl(Interface& interface, Control& control) {
   interface.UnselectTexture();
 }
 
+void Texture::RecaptureControl(
+    Interface& interface, Control& control,
+    const Span<::band::Rectangle>& regions) {
+  if (!texture_id_.has_value() || control.Area(interface) != area_) {
+    CaptureControl(interface, control);
+    return;
+  }
+
+  if (regions.n == 0u) {
+    return;
+  }
+
+  // The regions are drawn again at once within their union so the control is
+  // only displayed once however many regions there are.
+  ::band::WindowArea window_area = interface.WindowArea();
+  ::band::Rectangle clip = regions.values[0];
+  for (size_t i = 1u; i < regions.n; i++) {
+    const ::band::Rectangle& region = regions.values[i];
+    clip.bottom_left = Point{
+      .x = MinDimension(
+          clip.bottom_left.x, region.bottom_left.x, window_area.width),
+      .y = MinDimension(
+          clip.bottom_left.y, region.bottom_left.y, window_area.height)
+    };
+    clip.top_right = Point{
+      .x = MaxDimension(
+          clip.top_right.x, region.top_right.x, window_area.width),
+      .y = MaxDimension(
+          clip.top_right.y, region.top_right.y, window_area.height)
+    };
+  }
+
+  interface.SelectTexture(texture_id_.value());
+
+  // The clear is clipped so only the union is cleared before it's drawn again.
+  interface.StartClipping(clip);
+  interface.Clear(Color{});
+  control.Display(band::Point{}, interface);
+  interface.StopClipping();
+
+  interface.UnselectTexture();
+}
+
+void Texture::CaptureImage(
+    Interface& interface, ImageId id, const ::band::Area& area) {
+  if (texture_id_.has_value()) {
+    CleanUp(interface);
+  }
+
+  TextureId texture_id = interface.CreateImageTexture(id, area);
+  if (texture_id == 0u) {
+    return;
+  }
+
+  area_ = area;
+  texture_id_ = texture_id;
+}
+
 void Texture::CleanUp(Interface& interface) {
   if (!texture_id_.has_value()) {
     return;
@@ -29,6 +87,10 @@ void Texture::CleanUp(Interface& interface) {
   texture_id_ = std::nullopt;
 }
 
+std::optional<TextureId> Texture::Id() const {
+  return texture_id_;
+}
+
 ::band::Area Texture::Area(const Interface&) const {
   if (!texture_id_.has_value()) {
     return ::band::Area{};
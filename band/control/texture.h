@@ -8,12 +8,24 @@
 namespace band {
 namespace control {
 
-// Texture captures a texture of a control and displays it.
+// Texture captures a texture of a control or an image and displays it.
 class Texture : public Control {
   public:
     void CaptureControl(Interface& interface, Control& control);
+    // RecaptureControl redraws the union of the regions of the captured control
+    // and keeps the rest of the texture.
+    //
+    // Regions are relative to the control. The control is captured entirely if
+    // it wasn't captured before or its area changed.
+    void RecaptureControl(
+        Interface& interface, Control& control,
+        const Span<::band::Rectangle>& regions);
+    void CaptureImage(Interface& interface, ImageId id, const ::band::Area& area);
     void CleanUp(Interface& interface);
 
+    // Id of the captured texture.
+    std::optional<TextureId> Id() const;
+
     ::band::Area Area(const Interface& interface) const override;
 
     void Update(const Point& position, const Interface& interface) override;
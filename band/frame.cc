@@ -0,0 +1,26 @@
+#include "band/frame.h"
+
+namespace band {
+
+::band::Arena& Frame::Arena() {
+  return arena_;
+}
+
+double Frame::Alpha() const {
+  return alpha_;
+}
+
+void Frame::SetAlpha(double alpha) {
+  alpha_ = alpha;
+}
+
+uint64_t Frame::Index() const {
+  return index_;
+}
+
+void Frame::Finish() {
+  arena_.Reset();
+  index_++;
+}
+
+}  // namespace band
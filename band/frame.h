@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+
+#include "band/arena.h"
+
+namespace band {
+
+// Frame is the context of the frame being drawn.
+//
+// Interfaces own their frame and finish it once the frame is drawn.
+class Frame {
+  public:
+    // Arena for temporaries that only have to last until the frame is
+    // finished.
+    ::band::Arena& Arena();
+
+    // Alpha is how far the frame is between the last two fixed-timestep
+    // updates from 0 to 1.
+    //
+    // Controls interpolate between the states of the updates by the alpha. The
+    // alpha is 1 unless frames are driven by a loop so the latest state is
+    // drawn.
+    double Alpha() const;
+    void SetAlpha(double alpha);
+
+    // Index of the frame which counts the frames finished before it.
+    uint64_t Index() const;
+
+    // Finish the frame, freeing everything in its arena.
+    void Finish();
+
+  private:
+    ::band::Arena arena_{};
+    double alpha_ = 1.0;
+    uint64_t index_ = 0u;
+
+};
+
+}  // namespace band
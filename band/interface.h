@@ -6,8 +6,12 @@
 #include <optional>
 #include <string>
 
+#include "band/frame.h"
+
 namespace band {
 
+class Scheduler;
+
 // This file aliases lots of simple types. The reason for this is the desire to
 // minimize includes by dependents of this library. Since many of the types are
 // defined in many standard-headers, dependents would have to remember to import
@@ -15,10 +19,18 @@ namespace band {
 // providing more complex types for the aliases less of an undertaking in the
 // future.
 
+// Encoding of the bytes of a file.
+enum class Encoding { kRaw, kLz };
+
 // File is a wrapper around the bytes of a file.
+//
+// Encoded files are decoded by the interface while they're loaded. The decoded
+// size is only used for encoded files.
 struct File {
   const uint8_t* bytes;
   const size_t n;
+  const Encoding encoding = Encoding::kRaw;
+  const size_t decoded_n = 0u;
 };
 
 // Text is a sequence of characters.
@@ -151,6 +163,91 @@ bool operator!=(const Color& a, const Color& b);
 // Leg of a rectangle.
 enum class Leg { kWidth, kHeight };
 
+// Sprite is a source-region of a texture drawn into the destination with a
+// tint.
+//
+// Ratios of the source are relative to the texture's area.
+struct Sprite {
+  Rectangle source{};
+  Rectangle destination{};
+  Color tint{};
+};
+
+// Box is a rectangle filled with a color or, if it has a positive thickness,
+// a border of the thickness inside of the rectangle.
+//
+// A ratio thickness is relative to the smaller leg of the window's area.
+struct Box {
+  Rectangle rectangle{};
+  Color color{};
+  Dimension thickness{};
+};
+
+// Span is a view of contiguous values.
+template <typename T>
+struct Span {
+  const T* values;
+  const size_t n;
+
+  const T* begin() const { return values; }
+  const T* end() const { return values + n; }
+};
+
+// Filter used to sample a texture drawn at a different size than its own.
+//
+// Mipmapped filtering keeps shrunken textures from aliasing.
+enum class Filter { kNearest, kLinear, kMipmap };
+
+// FrameStats describes what drawing a frame cost.
+struct FrameStats {
+  // DrawCalls counts what was drawn by primitive. Bulk draws count once and
+  // culled draws don't count.
+  struct DrawCalls {
+    Size clears = 0u;
+    Size textures = 0u;
+    Size sprites = 0u;
+    Size lines = 0u;
+    Size circles = 0u;
+    Size rectangles = 0u;
+    Size triangles = 0u;
+    Size texts = 0u;
+  };
+
+  // ResidentBytes of textures by the resource they're kept for.
+  struct ResidentBytes {
+    uint64_t images = 0u;
+    uint64_t atlas_pages = 0u;
+    uint64_t render_targets = 0u;
+    uint64_t fonts = 0u;
+    uint64_t pooled = 0u;
+  };
+
+  // Seconds from the end of the frame before to the end of the frame.
+  Real frame_seconds = 0.0;
+  // Seconds spent between frames, drawing the frame, and presenting it. Drawn
+  // commands may only be recorded and actually drawn while presenting.
+  // Presenting includes waiting for the frame's deadline and running scheduled
+  // jobs.
+  Real update_seconds = 0.0;
+  Real display_seconds = 0.0;
+  Real present_seconds = 0.0;
+
+  DrawCalls draw_calls{};
+  // TextureBinds counts draws from a different texture than the draw before
+  // them.
+  Size texture_binds = 0u;
+  // TargetSwitches counts textures selected and unselected.
+  Size target_switches = 0u;
+  ResidentBytes resident_bytes{};
+  // Texts measured with 'MeasureText', not counting the measurements texts are
+  // drawn with.
+  Size measured_texts = 0u;
+  // Scale of the window's resolution the frame was drawn at.
+  Real resolution_scale = 1.0;
+  // Allocations on the heap during the frame if they're counted.
+  std::optional<Size> allocations = std::nullopt;
+};
+
 // Interface which can be drawn on and receives actions.
 //
 // If a texture is selected, the texture is drawn on instead.
@@ -167,6 +264,18 @@ class Interface {
     virtual ~Interface() = default;
 
     virtual void SetTargetFps(Size fps) = 0;
+    // SetDynamicResolution lets the interface draw at a lower resolution while
+    // frames take longer than the target FPS allows.
+    //
+    // Text and overlays are still drawn at the window's resolution but over
+    // everything else while the resolution is lowered.
+    virtual void SetDynamicResolution(bool is_enabled) = 0;
+    // SetResizeInterval the window's size must stay the same for while it's
+    // resized before the window's area changes to it.
+    //
+    // The last frame is drawn stretched over the window until then so
+    // controls aren't laid out for every size the window passes through.
+    virtual void SetResizeInterval(Real seconds) = 0;
     virtual void SetWindowArea(const ::band::WindowArea& area) = 0;
     virtual void SetIcon(ImageId id) = 0;
     virtual void SetTitle(const Text& text) = 0;
@@ -174,11 +283,20 @@ class Interface {
 
     virtual void StartDrawing() = 0;
     virtual void StopDrawing() = 0;
+    // Frame is the context of the frame being drawn which is finished when
+    // drawing is stopped.
+    virtual ::band::Frame& Frame() const = 0;
+    // Stats of the last drawn frame, including what was done while updating
+    // before it was drawn.
+    virtual FrameStats Stats() const = 0;
+    // Scheduler of jobs which are run once each frame is drawn.
+    virtual ::band::Scheduler& Scheduler() const = 0;
 
     virtual ImageId LoadImage(const File& file) = 0;
     virtual void DeleteImage(ImageId id) = 0;
     virtual void DeleteAllImages() = 0;
 
+    // LoadFont returns 0 if the font couldn't be loaded.
     virtual FontId LoadFont(const File& file) = 0;
     virtual void DeleteFont(FontId id) = 0;
     virtual void DeleteAllFonts() = 0;
@@ -189,9 +307,40 @@ class Interface {
     virtual void DeleteAllTextures() = 0;
     virtual void SelectTexture(TextureId id) = 0;
     virtual void UnselectTexture() = 0;
+    // SetTextureFilter for drawing the texture at other sizes.
+    //
+    // Textures created from the same image share a filter.
+    virtual void SetTextureFilter(TextureId id, const Filter& filter) = 0;
+    // TextureVersion changes whenever the texture is drawn on and is 0 if the
+    // texture doesn't exist.
+    virtual uint64_t TextureVersion(TextureId id) const = 0;
     virtual void DrawTexture(TextureId id, const Point& position) = 0;
+    // DrawTexture scaled to fill the area.
+    virtual void DrawTexture(
+        TextureId id, const Point& position, const Area& area) = 0;
+    // DrawTexture with the source-region of the texture scaled to fill the
+    // destination. Ratios of the source are relative to the texture's area.
+    virtual void DrawTexture(
+        TextureId id, const Rectangle& source,
+        const Rectangle& destination) = 0;
+    // DrawSprites of the texture in a single batch with the destinations
+    // relative to the position.
+    virtual void DrawSprites(
+        TextureId id, const Point& position, const Span<Sprite>& sprites) = 0;
 
     virtual void Clear(const Color& color) = 0;
+    // StartClipping so only what's drawn within the rectangle is drawn until
+    // clipping is stopped.
+    //
+    // Clipping doesn't nest and clears are clipped too.
+    virtual void StartClipping(const Rectangle& rectangle) = 0;
+    virtual void StopClipping() = 0;
+    // StartOverlay so what's drawn until the overlay is stopped is drawn at the
+    // window's resolution even while the resolution is lowered.
+    //
+    // Overlays are for what's drawn over everything else anyway like HUDs.
+    virtual void StartOverlay() = 0;
+    virtual void StopOverlay() = 0;
     // DrawLine with a thickness determined by the size fo the leg of the window's
     // area if a ratio-dimension is passed.
     virtual void DrawLine(
@@ -203,8 +352,29 @@ class Interface {
         const Circle& circle, const Leg& leg, const Color& color) = 0;
     virtual void DrawRectangle(
         const Rectangle& rectangle, const Color& color) = 0;
+    // DrawBox which may be deferred and drawn with other boxes in a single
+    // batch. Boxes are always drawn before anything drawn after them.
+    virtual void DrawBox(const Box& box) = 0;
     // DrawTriangle with points specified in counter-clockwise order.
     virtual void DrawTriangle(const Triangle& triangle, const Color& color) = 0;
+    // DrawLines like 'DrawLine' in a single batch.
+    virtual void DrawLines(
+        const Span<Line>& lines, const Dimension& thickness,
+        const Leg& leg, const Color& color) = 0;
+    // DrawCircles like 'DrawCircle' in a single batch.
+    virtual void DrawCircles(
+        const Span<Circle>& circles, const Leg& leg, const Color& color) = 0;
+    // DrawRectangles like 'DrawRectangle' in a single batch.
+    virtual void DrawRectangles(
+        const Span<Rectangle>& rectangles, const Color& color) = 0;
+    // DrawRectangles with a color each in a single batch. Rectangles without
+    // a color aren't drawn.
+    virtual void DrawRectangles(
+        const Span<Rectangle>& rectangles, const Span<Color>& colors) = 0;
+    // DrawPolyline of lines between consecutive points in a single batch.
+    virtual void DrawPolyline(
+        const Span<Point>& points, const Dimension& thickness,
+        const Leg& leg, const Color& color) = 0;
     // DrawText where each character has a dimension with ratio relative to the
     // window's height.
     virtual void DrawText(
@@ -0,0 +1,92 @@
+#include "band/interface/frame_pacer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace band {
+namespace interface {
+
+namespace {
+
+Real Seconds(FramePacer::Clock::duration duration) {
+  return std::chrono::duration<Real>(duration).count();
+}
+
+FramePacer::Clock::duration Duration(Real seconds) {
+  return std::chrono::duration_cast<FramePacer::Clock::duration>(
+      std::chrono::duration<Real>(seconds));
+}
+
+}  // namespace
+
+void FramePacer::SetTargetFps(Size fps) {
+  period_ = fps == 0u ? Clock::duration{} : Duration(1.0 / fps);
+  deadline_ = std::nullopt;
+  last_wait_ = std::nullopt;
+  ResetJitter();
+}
+
+Real FramePacer::Wait() {
+  if (period_ == Clock::duration{}) {
+    return 0.0;
+  }
+
+  Clock::time_point start = Clock::now();
+  if (deadline_.has_value()) {
+    SleepUntil(deadline_.value());
+  }
+
+  Clock::time_point now = Clock::now();
+  if (last_wait_.has_value()) {
+    Real jitter = std::abs(Seconds(now - last_wait_.value() - period_));
+    Size bin = static_cast<Size>(
+        std::min(jitter / kJitterBinSeconds, Real{kJitterBins - 1u}));
+    jitter_.histogram[bin]++;
+    jitter_.intervals++;
+    jitter_.max_seconds = std::max(jitter_.max_seconds, jitter);
+  }
+  last_wait_ = now;
+
+  if (!deadline_.has_value() || now - deadline_.value() >= period_) {
+    deadline_ = now;
+  }
+  deadline_ = deadline_.value() + period_;
+
+  return Seconds(now - start);
+}
+
+Real FramePacer::MarginSeconds() const {
+  return margin_seconds_;
+}
+
+FramePacer::JitterStats FramePacer::Jitter() const {
+  return jitter_;
+}
+
+void FramePacer::ResetJitter() {
+  jitter_ = JitterStats{};
+}
+
+void FramePacer::SleepUntil(Clock::time_point deadline) {
+  Clock::time_point wake = deadline - Duration(margin_seconds_);
+  if (Clock::now() < wake) {
+    std::this_thread::sleep_until(wake);
+
+    // The margin keeps half again the lateness so small variations don't make
+    // sleeps overshoot the deadline.
+    Real lateness = Seconds(Clock::now() - wake) * 1.5;
+    if (lateness > margin_seconds_) {
+      margin_seconds_ = lateness;
+    } else {
+      margin_seconds_ -= (margin_seconds_ - lateness) / 16.0;
+    }
+    margin_seconds_ = std::clamp(
+        margin_seconds_, kMinMarginSeconds, kMaxMarginSeconds);
+  }
+
+  while (Clock::now() < deadline) { }
+}
+
+}  // namespace interface
+}  // namespace band
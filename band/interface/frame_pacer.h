@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <optional>
+
+#include "band/interface.h"
+
+namespace band {
+namespace interface {
+
+// FramePacer waits between frames so they're presented at a target rate.
+//
+// Sleeping alone wakes up too late by an amount that varies between systems, so
+// the pacer sleeps until a margin before the deadline and spins the rest. The
+// margin grows quickly when a sleep overshoots it and shrinks slowly otherwise
+// so the least time is spent spinning.
+//
+// Deadlines are a fixed period apart so a late frame doesn't delay the ones
+// after it. A frame late by over a period restarts the deadlines instead of
+// presenting the missed frames back-to-back.
+class FramePacer {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr Size kJitterBins = 16u;
+    static constexpr Real kJitterBinSeconds = 0.00025;
+
+    // JitterStats describes how far the intervals between waits were from the
+    // period.
+    struct JitterStats {
+      // Histogram counts the intervals in bins kJitterBinSeconds wide. The last
+      // bin also counts intervals further from the period than it.
+      std::array<Size, kJitterBins> histogram{};
+      Size intervals = 0u;
+      Real max_seconds = 0.0;
+    };
+
+    // SetTargetFps with 0 stops pacing.
+    void SetTargetFps(Size fps);
+
+    // Wait until the next deadline, returning the seconds waited.
+    Real Wait();
+
+    // MarginSeconds is how long before a deadline the pacer stops sleeping.
+    Real MarginSeconds() const;
+
+    JitterStats Jitter() const;
+    void ResetJitter();
+
+  private:
+    static constexpr Real kMinMarginSeconds = 0.0002;
+    static constexpr Real kMaxMarginSeconds = 0.004;
+
+    // SleepUntil the deadline, adapting the margin to how late the sleep was.
+    void SleepUntil(Clock::time_point deadline);
+
+    Clock::duration period_{};
+    Real margin_seconds_ = 0.001;
+    std::optional<Clock::time_point> deadline_{};
+    std::optional<Clock::time_point> last_wait_{};
+    JitterStats jitter_{};
+
+};
+
+}  // namespace interface
+}  // namespace band
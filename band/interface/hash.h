@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "band/interface.h"
+
+namespace band {
+namespace interface {
+
+// Hash combines the hash with values using FNV-1a.
+//
+// Band's types are hashed field by field since their padding isn't
+// initialized. Hashes start from the seed.
+constexpr uint64_t kHashSeed = 14695981039346656037u;
+
+inline uint64_t Hash(uint64_t hash, const void* bytes, size_t n) {
+  const uint8_t* values = reinterpret_cast<const uint8_t*>(bytes);
+  for (size_t i = 0u; i < n; i++) {
+    hash ^= values[i];
+    hash *= 1099511628211u;
+  }
+
+  return hash;
+}
+
+inline uint64_t Hash(uint64_t hash, uint64_t value) {
+  return Hash(hash, &value, sizeof(value));
+}
+
+inline uint64_t Hash(uint64_t hash, Real value) {
+  return Hash(hash, &value, sizeof(value));
+}
+
+template <typename T, typename = std::enable_if_t<std::is_enum_v<T>>>
+uint64_t Hash(uint64_t hash, T value) {
+  return Hash(hash, static_cast<uint64_t>(value));
+}
+
+inline uint64_t Hash(uint64_t hash, const Text& text) {
+  return Hash(Hash(hash, text.data(), text.size()), text.size());
+}
+
+inline uint64_t Hash(uint64_t hash, const Dimension& dimension) {
+  return Hash(Hash(hash, dimension.scalar), dimension.unit);
+}
+
+inline uint64_t Hash(uint64_t hash, const Point& point) {
+  return Hash(Hash(hash, point.x), point.y);
+}
+
+inline uint64_t Hash(uint64_t hash, const Line& line) {
+  return Hash(Hash(hash, line.a), line.b);
+}
+
+inline uint64_t Hash(uint64_t hash, const Circle& circle) {
+  return Hash(Hash(hash, circle.center), circle.radius);
+}
+
+inline uint64_t Hash(uint64_t hash, const Triangle& triangle) {
+  return Hash(Hash(Hash(hash, triangle.a), triangle.b), triangle.c);
+}
+
+inline uint64_t Hash(uint64_t hash, const Rectangle& rectangle) {
+  return Hash(Hash(hash, rectangle.bottom_left), rectangle.top_right);
+}
+
+inline uint64_t Hash(uint64_t hash, const Area& area) {
+  return Hash(Hash(hash, area.width), area.height);
+}
+
+inline uint64_t Hash(uint64_t hash, const WindowArea& area) {
+  return Hash(Hash(hash, area.width), area.height);
+}
+
+inline uint64_t Hash(uint64_t hash, const Color& color) {
+  uint8_t components[] = { color.r, color.g, color.b, color.a };
+  return Hash(hash, components, sizeof(components));
+}
+
+inline uint64_t Hash(uint64_t hash, const Box& box) {
+  return Hash(Hash(Hash(hash, box.rectangle), box.color), box.thickness);
+}
+
+inline uint64_t Hash(uint64_t hash, const Sprite& sprite) {
+  return Hash(
+      Hash(Hash(hash, sprite.source), sprite.destination), sprite.tint);
+}
+
+template <typename T>
+uint64_t Hash(uint64_t hash, const Span<T>& span) {
+  for (size_t i = 0u; i < span.n; i++) {
+    hash = Hash(hash, span.values[i]);
+  }
+
+  return Hash(hash, static_cast<uint64_t>(span.n));
+}
+
+template <typename T, typename U, typename... Ts>
+uint64_t Hash(uint64_t hash, const T& value, const U& next, const Ts&... rest) {
+  return Hash(Hash(hash, value), next, rest...);
+}
+
+}  // namespace interface
+}  // namespace band
@@ -0,0 +1,247 @@
+#include "band/interface/hashing_interface.h"
+
+#include "band/interface/hash.h"
+
+namespace band {
+namespace interface {
+
+namespace {
+
+// Kind of a drawing which is hashed first so different drawings with the same
+// arguments hash differently.
+enum class Drawing {
+  kSelect, kUnselect, kTexture, kScaledTexture, kTextureRegion, kSprites,
+  kClear, kStartClipping, kStopClipping, kStartOverlay, kStopOverlay, kLine,
+  kCircle, kRectangle, kBox, kTriangle, kLines, kCircles, kRectangles,
+  kColoredRectangles, kPolyline, kText
+};
+
+}  // namespace
+
+HashingInterface::HashingInterface(Interface& interface) :
+  interface_{interface}, hash_{kHashSeed}, is_volatile_{false} { }
+
+uint64_t HashingInterface::DrawnHash() const {
+  return hash_;
+}
+
+bool HashingInterface::IsVolatile() const {
+  return is_volatile_;
+}
+
+void HashingInterface::SetTargetFps(Size) { }
+
+void HashingInterface::SetDynamicResolution(bool) { }
+
+void HashingInterface::SetResizeInterval(Real) { }
+
+void HashingInterface::SetWindowArea(const ::band::WindowArea&) { }
+
+void HashingInterface::SetIcon(ImageId) { }
+
+void HashingInterface::SetTitle(const Text&) { }
+
+void HashingInterface::ToggleFullscreen() { }
+
+void HashingInterface::StartDrawing() { }
+
+void HashingInterface::StopDrawing() { }
+
+::band::Frame& HashingInterface::Frame() const {
+  return interface_.Frame();
+}
+
+FrameStats HashingInterface::Stats() const {
+  return interface_.Stats();
+}
+
+::band::Scheduler& HashingInterface::Scheduler() const {
+  return interface_.Scheduler();
+}
+
+ImageId HashingInterface::LoadImage(const File& file) {
+  return interface_.LoadImage(file);
+}
+
+void HashingInterface::DeleteImage(ImageId id) {
+  interface_.DeleteImage(id);
+}
+
+void HashingInterface::DeleteAllImages() {
+  interface_.DeleteAllImages();
+}
+
+FontId HashingInterface::LoadFont(const File& file) {
+  return interface_.LoadFont(file);
+}
+
+void HashingInterface::DeleteFont(FontId id) {
+  interface_.DeleteFont(id);
+}
+
+void HashingInterface::DeleteAllFonts() {
+  interface_.DeleteAllFonts();
+}
+
+TextureId HashingInterface::CreateBlankTexture(const Area& area) {
+  return interface_.CreateBlankTexture(area);
+}
+
+TextureId HashingInterface::CreateImageTexture(ImageId id, const Area& area) {
+  return interface_.CreateImageTexture(id, area);
+}
+
+void HashingInterface::DeleteTexture(TextureId id) {
+  interface_.DeleteTexture(id);
+}
+
+void HashingInterface::DeleteAllTextures() {
+  interface_.DeleteAllTextures();
+}
+
+void HashingInterface::SelectTexture(TextureId id) {
+  hash_ = Hash(hash_, Drawing::kSelect, id);
+}
+
+void HashingInterface::UnselectTexture() {
+  hash_ = Hash(hash_, Drawing::kUnselect);
+}
+
+void HashingInterface::SetTextureFilter(TextureId id, const Filter& filter) {
+  interface_.SetTextureFilter(id, filter);
+}
+
+uint64_t HashingInterface::TextureVersion(TextureId id) const {
+  return interface_.TextureVersion(id);
+}
+
+void HashingInterface::DrawTexture(TextureId id, const Point& position) {
+  hash_ = Hash(hash_, Drawing::kTexture, id, TextureVersion(id), position);
+}
+
+void HashingInterface::DrawTexture(
+    TextureId id, const Point& position, const Area& area) {
+  hash_ = Hash(
+      hash_, Drawing::kScaledTexture, id, TextureVersion(id), position, area);
+}
+
+void HashingInterface::DrawTexture(
+    TextureId id, const Rectangle& source, const Rectangle& destination) {
+  hash_ = Hash(
+      hash_, Drawing::kTextureRegion, id, TextureVersion(id), source,
+      destination);
+}
+
+void HashingInterface::DrawSprites(
+    TextureId id, const Point& position, const Span<Sprite>& sprites) {
+  hash_ = Hash(
+      hash_, Drawing::kSprites, id, TextureVersion(id), position, sprites);
+}
+
+void HashingInterface::Clear(const Color& color) {
+  hash_ = Hash(hash_, Drawing::kClear, color);
+}
+
+void HashingInterface::StartClipping(const Rectangle& rectangle) {
+  hash_ = Hash(hash_, Drawing::kStartClipping, rectangle);
+}
+
+void HashingInterface::StopClipping() {
+  hash_ = Hash(hash_, Drawing::kStopClipping);
+}
+
+void HashingInterface::StartOverlay() {
+  hash_ = Hash(hash_, Drawing::kStartOverlay);
+}
+
+void HashingInterface::StopOverlay() {
+  hash_ = Hash(hash_, Drawing::kStopOverlay);
+}
+
+void HashingInterface::DrawLine(
+    const Line& line, const Dimension& thickness,
+    const Leg& leg, const Color& color) {
+  hash_ = Hash(hash_, Drawing::kLine, line, thickness, leg, color);
+}
+
+void HashingInterface::DrawCircle(
+    const Circle& circle, const Leg& leg, const Color& color) {
+  hash_ = Hash(hash_, Drawing::kCircle, circle, leg, color);
+}
+
+void HashingInterface::DrawRectangle(
+    const Rectangle& rectangle, const Color& color) {
+  hash_ = Hash(hash_, Drawing::kRectangle, rectangle, color);
+}
+
+void HashingInterface::DrawBox(const Box& box) {
+  hash_ = Hash(hash_, Drawing::kBox, box);
+}
+
+void HashingInterface::DrawTriangle(
+    const Triangle& triangle, const Color& color) {
+  hash_ = Hash(hash_, Drawing::kTriangle, triangle, color);
+}
+
+void HashingInterface::DrawLines(
+    const Span<Line>& lines, const Dimension& thickness,
+    const Leg& leg, const Color& color) {
+  hash_ = Hash(hash_, Drawing::kLines, lines, thickness, leg, color);
+}
+
+void HashingInterface::DrawCircles(
+    const Span<Circle>& circles, const Leg& leg, const Color& color) {
+  hash_ = Hash(hash_, Drawing::kCircles, circles, leg, color);
+}
+
+void HashingInterface::DrawRectangles(
+    const Span<Rectangle>& rectangles, const Color& color) {
+  hash_ = Hash(hash_, Drawing::kRectangles, rectangles, color);
+}
+
+void HashingInterface::DrawRectangles(
+    const Span<Rectangle>& rectangles, const Span<Color>& colors) {
+  hash_ = Hash(hash_, Drawing::kColoredRectangles, rectangles, colors);
+}
+
+void HashingInterface::DrawPolyline(
+    const Span<Point>& points, const Dimension& thickness,
+    const Leg& leg, const Color& color) {
+  hash_ = Hash(hash_, Drawing::kPolyline, points, thickness, leg, color);
+}
+
+void HashingInterface::DrawText(
+    const Text& text, const Point& position,
+    const Dimension& dimension, const Color& color,
+    FontId id) {
+  hash_ = Hash(hash_, Drawing::kText, text, position, dimension, color, id);
+}
+
+void HashingInterface::DrawFps(const Point&) {
+  is_volatile_ = true;
+}
+
+Area HashingInterface::MeasureText(
+    const Text& text, const Dimension& dimension,
+    FontId id) const {
+  return interface_.MeasureText(text, dimension, id);
+}
+
+bool HashingInterface::HasAction(const Action& action) const {
+  return interface_.HasAction(action);
+}
+
+std::optional<char> HashingInterface::CharacterPressed() const {
+  return interface_.CharacterPressed();
+}
+
+Point HashingInterface::MousePosition() const {
+  return interface_.MousePosition();
+}
+
+::band::WindowArea HashingInterface::WindowArea() const {
+  return interface_.WindowArea();
+}
+
+}  // namespace interface
+}  // namespace band
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "band/interface.h"
+
+namespace band {
+namespace interface {
+
+// HashingInterface hashes what's drawn on it instead of drawing it.
+//
+// Queries and resources are forwarded to the wrapped interface so controls
+// measure and load like they would on it. Window and frame changes are
+// ignored. The hash changes if anything drawn changes, except what's drawn by
+// the FPS counter which instead marks the drawing volatile.
+class HashingInterface : public Interface {
+  public:
+    explicit HashingInterface(Interface& interface);
+
+    // DrawnHash of everything drawn so far.
+    uint64_t DrawnHash() const;
+
+    // IsVolatile returns if something was drawn which changes without its
+    // arguments changing.
+    bool IsVolatile() const;
+
+    void SetTargetFps(Size fps) override;
+    void SetDynamicResolution(bool is_enabled) override;
+    void SetResizeInterval(Real seconds) override;
+    void SetWindowArea(const ::band::WindowArea& area) override;
+    void SetIcon(ImageId id) override;
+    void SetTitle(const Text& text) override;
+    void ToggleFullscreen() override;
+
+    void StartDrawing() override;
+    void StopDrawing() override;
+    ::band::Frame& Frame() const override;
+    FrameStats Stats() const override;
+    ::band::Scheduler& Scheduler() const override;
+
+    ImageId LoadImage(const File& file) override;
+    void DeleteImage(ImageId id) override;
+    void DeleteAllImages() override;
+
+    FontId LoadFont(const File& file) override;
+    void DeleteFont(FontId id) override;
+    void DeleteAllFonts() override;
+
+    TextureId CreateBlankTexture(const Area& area) override;
+    TextureId CreateImageTexture(ImageId id, const Area& area) override;
+    void DeleteTexture(TextureId id) override;
+    void DeleteAllTextures() override;
+    void SelectTexture(TextureId id) override;
+    void UnselectTexture() override;
+    void SetTextureFilter(TextureId id, const Filter& filter) override;
+    uint64_t TextureVersion(TextureId id) const override;
+    void DrawTexture(TextureId id, const Point& position) override;
+    void DrawTexture(
+        TextureId id, const Point& position, const Area& area) override;
+    void DrawTexture(
+        TextureId id, const Rectangle& source,
+        const Rectangle& destination) override;
+    void DrawSprites(
+        TextureId id, const Point& position,
+        const Span<Sprite>& sprites) override;
+
+    void Clear(const Color& color) override;
+    void StartClipping(const Rectangle& rectangle) override;
+    void StopClipping() override;
+    void StartOverlay() override;
+    void StopOverlay() override;
+    void DrawLine(
+        const Line& line, const Dimension& thickness,
+        const Leg& leg, const Color& color) override;
+    void DrawCircle(
+        const Circle& circle, const Leg& leg, const Color& color) override;
+    void DrawRectangle(const Rectangle& rectangle, const Color& color) override;
+    void DrawBox(const Box& box) override;
+    void DrawTriangle(const Triangle& triangle, const Color& color) override;
+    void DrawLines(
+        const Span<Line>& lines, const Dimension& thickness,
+        const Leg& leg, const Color& color) override;
+    void DrawCircles(
+        const Span<Circle>& circles,
+        const Leg& leg, const Color& color) override;
+    void DrawRectangles(
+        const Span<Rectangle>& rectangles, const Color& color) override;
+    void DrawRectangles(
+        const Span<Rectangle>& rectangles,
+        const Span<Color>& colors) override;
+    void DrawPolyline(
+        const Span<Point>& points, const Dimension& thickness,
+        const Leg& leg, const Color& color) override;
+    void DrawText(
+        const Text& text, const Point& position,
+        const Dimension& dimension, const Color& color,
+        FontId id) override;
+    void DrawFps(const Point& position) override;
+
+    Area MeasureText(
+        const Text& text, const Dimension& dimension,
+        FontId id) const override;
+    bool HasAction(const Action& action) const override;
+    std::optional<char> CharacterPressed() const override;
+    Point MousePosition() const override;
+    ::band::WindowArea WindowArea() const override;
+
+  private:
+    Interface& interface_;
+
+    uint64_t hash_;
+    bool is_volatile_;
+
+};
+
+}  // namespace interface
+}  // namespace band
@@ -1,8 +1,19 @@
 #include "band/interface/raylib_interface.h"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cmath>
-
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+#include "band/allocation.h"
+#include "band/asset/lz.h"
+#include "band/interface/hash.h"
 #include "raylib.h"
+#include "rlgl.h"
 
 #include <iostream>
 
@@ -18,11 +29,433 @@ namespace interface {
 
 namespace {
 
+// Sprites are submitted in chunks that always fit in raylib's batch.
+constexpr size_t kSpritesPerBatch = 1024u;
+
+// Images no larger than this on either side are packed onto atlas-pages of
+// the page size. Packed images are padded so filtering doesn't bleed.
+constexpr int kAtlasMaxImageSize = 256;
+constexpr int kAtlasPageSize = 1024;
+constexpr int kAtlasPadding = 1;
+
+// Pooled render-targets unused for this many frames are freed.
+constexpr Size kTexturePoolFrames = 120u;
+// Pooled render-targets are freed oldest first past this many bytes.
+constexpr uint64_t kTexturePoolBytes = 64u << 20u;
+
+// Sizes the window is resized to must stay the same this long to be laid out
+// unless it's set otherwise.
+constexpr Real kResizeIntervalSeconds = 0.2;
+
+// TextureBytes of the texture's RGBA pixels.
+uint64_t TextureBytes(const ::Texture2D& texture) {
+  return static_cast<uint64_t>(texture.width) *
+    static_cast<uint64_t>(texture.height) * 4u;
+}
+
+uint64_t TargetBytes(const ::RenderTexture2D& target) {
+  return TextureBytes(target.texture);
+}
+
+// Seconds from the start to the stop.
+Real Seconds(
+    const std::chrono::steady_clock::time_point& start,
+    const std::chrono::steady_clock::time_point& stop) {
+  return std::chrono::duration<Real>(stop - start).count();
+}
+
 Real ConvertDimensionToPixel(const Dimension& dimension, Real pixels) {
   return dimension.unit == Unit::kPixel ?
     dimension.scalar : dimension.scalar * pixels;
 }
 
+Real ConvertLegToPixel(
+    const Dimension& dimension, const Leg& leg,
+    const ::band::WindowArea& area) {
+  return leg == Leg::kWidth ?
+    ConvertDimensionToPixel(dimension, area.width) :
+    ConvertDimensionToPixel(dimension, area.height);
+}
+
+static_assert(
+    static_cast<int>(Unit::kPixel) == 0 && static_cast<int>(Unit::kRatio) == 1,
+    "ConvertToPixels scales by the unit's value");
+
+// ConvertToPixels converts the dimension selected from each value to pixels.
+//
+// The unit scales the dimension arithmetically instead of branching so the
+// loop vectorizes.
+template <typename T, typename F>
+void ConvertToPixels(
+    const Span<T>& values, const F& select, Real pixels, float* out) {
+  Real scale = pixels - 1.0;
+
+  for (size_t i = 0u; i < values.n; i++) {
+    const Dimension& dimension = select(values.values[i]);
+    out[i] = static_cast<float>(
+        dimension.scalar * (1.0 + scale * static_cast<int>(dimension.unit)));
+  }
+}
+
+// Bulk primitives are submitted in chunks of at most this many vertices so
+// they always fit in raylib's batch.
+constexpr size_t kVerticesPerBatch = 4096u;
+
+// Circles are fans of triangles whose edges stray at most this many pixels
+// from the true circle like raylib's own circles.
+constexpr float kCircleError = 0.5f;
+
+// Tessellated shapes are cached up to this many vertices.
+constexpr size_t kTessellationCacheVertices = 1u << 18u;
+
+// EmitVertex with its own color since raylib only fills in missing colors at
+// the end of a batch.
+void EmitVertex(float x, float y, const ::Color& color) {
+  ::rlColor4ub(color.r, color.g, color.b, color.a);
+  ::rlVertex2f(x, y);
+}
+
+// EmitLine emits the line between the points with the half-thickness as two
+// counter-clockwise triangles.
+void EmitLine(
+    float ax, float ay, float bx, float by,
+    float half_thickness, const ::Color& color) {
+  float dx = bx - ax;
+  float dy = by - ay;
+  float length = std::sqrt(dx * dx + dy * dy);
+  if (length == 0.0f) {
+    return;
+  }
+
+  float nx = -dy / length * half_thickness;
+  float ny = dx / length * half_thickness;
+
+  EmitVertex(ax - nx, ay - ny, color);
+  EmitVertex(ax + nx, ay + ny, color);
+  EmitVertex(bx + nx, by + ny, color);
+
+  EmitVertex(ax - nx, ay - ny, color);
+  EmitVertex(bx + nx, by + ny, color);
+  EmitVertex(bx - nx, by - ny, color);
+}
+
+// TessellateCircle into counter-clockwise triangles around the origin.
+std::vector<float> TessellateCircle(float radius) {
+  radius = std::abs(radius);
+
+  size_t segments = 4u;
+  if (radius > kCircleError) {
+    float step = std::acos(
+        2.0f * std::pow(1.0f - kCircleError / radius, 2.0f) - 1.0f);
+    segments = std::max(
+        segments, static_cast<size_t>(std::ceil(2.0f * M_PI / step)));
+  }
+
+  std::vector<float> vertices{};
+  vertices.reserve(6u * segments);
+
+  // Angles increase clockwise on the window so each fan-triangle is emitted
+  // backwards to be counter-clockwise.
+  for (size_t i = 0u; i < segments; i++) {
+    double a = 2.0 * M_PI * i / segments;
+    double b = 2.0 * M_PI * (i + 1u) / segments;
+
+    vertices.insert(vertices.end(), {
+        0.0f, 0.0f,
+        static_cast<float>(std::cos(b) * radius),
+        static_cast<float>(std::sin(b) * radius),
+        static_cast<float>(std::cos(a) * radius),
+        static_cast<float>(std::sin(a) * radius)
+    });
+  }
+
+  return vertices;
+}
+
+// EmitTriangles of the cached vertices translated to the position.
+void EmitTessellation(
+    const std::vector<float>& vertices, float x, float y,
+    const ::Color& color) {
+  if (vertices.empty()) {
+    return;
+  }
+
+  if (::rlCheckBufferLimit(static_cast<int>(vertices.size() / 2u))) {
+    ::rlglDraw();
+  }
+
+  ::rlBegin(RL_TRIANGLES);
+  for (size_t i = 0u; i < vertices.size(); i += 2u) {
+    EmitVertex(x + vertices[i], y + vertices[i + 1u], color);
+  }
+  ::rlEnd();
+}
+
+// EmitRectangle emits the rectangle between the corners as two
+// counter-clockwise triangles.
+void EmitRectangle(
+    float ax, float ay, float bx, float by, const ::Color& color) {
+  float left = std::min(ax, bx);
+  float right = std::max(ax, bx);
+  float top = std::min(ay, by);
+  float bottom = std::max(ay, by);
+
+  EmitVertex(left, top, color);
+  EmitVertex(left, bottom, color);
+  EmitVertex(right, bottom, color);
+
+  EmitVertex(left, top, color);
+  EmitVertex(right, bottom, color);
+  EmitVertex(right, top, color);
+}
+
+// EmitBox emits the rectangle between the corners filled if the thickness
+// isn't positive and otherwise emits a border of the thickness inside of it.
+void EmitBox(
+    float ax, float ay, float bx, float by, float thickness,
+    const ::Color& color) {
+  float left = std::min(ax, bx);
+  float right = std::max(ax, bx);
+  float top = std::min(ay, by);
+  float bottom = std::max(ay, by);
+
+  if (thickness <= 0.0f ||
+      2.0f * thickness >= std::min(right - left, bottom - top)) {
+    EmitRectangle(left, top, right, bottom, color);
+    return;
+  }
+
+  // The sides don't overlap so translucent borders have even corners.
+  EmitRectangle(left, top, right, top + thickness, color);
+  EmitRectangle(left, bottom - thickness, right, bottom, color);
+  EmitRectangle(
+      left, top + thickness, left + thickness, bottom - thickness, color);
+  EmitRectangle(
+      right - thickness, top + thickness, right, bottom - thickness, color);
+}
+
+// EmitTriangles emits n primitives of the given vertices each in chunks that
+// fit in raylib's batch.
+template <typename F>
+void EmitTriangles(size_t n, size_t vertices, const F& emit) {
+  size_t per_batch = std::max<size_t>(kVerticesPerBatch / vertices, 1u);
+
+  for (size_t start = 0u; start < n; start += per_batch) {
+    size_t end = std::min(start + per_batch, n);
+
+    if (::rlCheckBufferLimit(static_cast<int>(vertices * (end - start)))) {
+      ::rlglDraw();
+    }
+
+    ::rlBegin(RL_TRIANGLES);
+    for (size_t i = start; i < end; i++) {
+      emit(i);
+    }
+    ::rlEnd();
+  }
+}
+
+void ApplyFilter(::Texture2D& texture, const Filter& filter) {
+  switch (filter) {
+  case Filter::kNearest:
+    ::SetTextureFilter(texture, FILTER_POINT);
+    break;
+  case Filter::kMipmap:
+    ::GenTextureMipmaps(&texture);
+    ::SetTextureFilter(texture, FILTER_TRILINEAR);
+    break;
+  case Filter::kLinear:
+  default:
+    ::SetTextureFilter(texture, FILTER_BILINEAR);
+    break;
+  }
+}
+
+// RenderToTarget renders into the target with the function and then restores
+// the selected target since beginning to render into one ends the other.
+template <typename F>
+void RenderToTarget(
+    const ::RenderTexture2D& target, const ::RenderTexture2D* selected,
+    const F& f) {
+  ::BeginTextureMode(target);
+  f();
+  ::EndTextureMode();
+
+  if (selected != nullptr) {
+    ::BeginTextureMode(*selected);
+  }
+}
+
+// Bounds of a command in pixels.
+struct Bounds {
+  float left;
+  float top;
+  float right;
+  float bottom;
+};
+
+// Kind of a recorded command which is hashed first so different commands
+// with the same arguments hash differently.
+enum class CommandKind {
+  kTexture, kScaledTexture, kTextureRegion, kSprites, kClear, kLine, kCircle,
+  kBox, kTriangle, kLines, kCircles, kRectangles, kColoredRectangles,
+  kPolyline, kText, kFps, kStartClipping, kStopClipping
+};
+
+// At most this many of the largest opaque commands occlude commands before
+// them.
+constexpr size_t kOccluders = 16u;
+
+Bounds WindowBounds(const ::band::WindowArea& area) {
+  return Bounds{
+    .left = 0.0f,
+    .top = 0.0f,
+    .right = static_cast<float>(area.width),
+    .bottom = static_cast<float>(area.height)
+  };
+}
+
+// PointsBounds returns the bounds of the points grown by the margin.
+Bounds PointsBounds(
+    const std::initializer_list<Point>& points, const ::band::WindowArea& area,
+    float margin) {
+  Bounds bounds{
+    .left = INFINITY, .top = INFINITY, .right = -INFINITY, .bottom = -INFINITY
+  };
+
+  for (const Point& point : points) {
+    float x = static_cast<float>(ConvertDimensionToPixel(point.x, area.width));
+    float y = static_cast<float>(ConvertDimensionToPixel(point.y, area.height));
+
+    bounds.left = std::min(bounds.left, x - margin);
+    bounds.top = std::min(bounds.top, y - margin);
+    bounds.right = std::max(bounds.right, x + margin);
+    bounds.bottom = std::max(bounds.bottom, y + margin);
+  }
+
+  return bounds;
+}
+
+bool IsOverlapping(const Bounds& a, const Bounds& b) {
+  return a.left < b.right && b.left < a.right &&
+    a.top < b.bottom && b.top < a.bottom;
+}
+
+bool ContainsBounds(const Bounds& a, const Bounds& b) {
+  return a.left <= b.left && a.top <= b.top &&
+    a.right >= b.right && a.bottom >= b.bottom;
+}
+
+// BoundsArea returns the area of the bounds within the window's bounds.
+Real BoundsArea(const Bounds& bounds, const Bounds& window) {
+  Real width = std::min(bounds.right, window.right) -
+    std::max(bounds.left, window.left);
+  Real height = std::min(bounds.bottom, window.bottom) -
+    std::max(bounds.top, window.top);
+
+  return width > 0.0 && height > 0.0 ? width * height : 0.0;
+}
+
+// IsImageOpaque returns if no pixel of the image is translucent.
+bool IsImageOpaque(const ::Image& image) {
+  if (image.data == nullptr) {
+    return false;
+  }
+
+  switch (image.format) {
+  case UNCOMPRESSED_GRAYSCALE:
+  case UNCOMPRESSED_R5G6B5:
+  case UNCOMPRESSED_R8G8B8:
+  case UNCOMPRESSED_R32G32B32:
+    return true;
+  default:
+    break;
+  }
+
+  ::Color* colors = ::GetImageData(image);
+  if (colors == nullptr) {
+    return false;
+  }
+
+  bool is_opaque = std::all_of(
+      colors, colors + static_cast<size_t>(image.width) * image.height,
+      [](const ::Color& color) { return color.a == 0xff; });
+  RL_FREE(colors);
+
+  return is_opaque;
+}
+
+// EmitQuad emits a textured quad into raylib's batch.
+//
+// The region is in normalized texture-coordinates and the source is normalized
+// to the region. A region with a negative height is flipped vertically.
+void EmitQuad(
+    const ::Rectangle& region, const ::Rectangle& source,
+    const ::Rectangle& destination, const ::Color& tint) {
+  float u0 = region.x + source.x * region.width;
+  float v0 = region.y + source.y * region.height;
+  float u1 = region.x + (source.x + source.width) * region.width;
+  float v1 = region.y + (source.y + source.height) * region.height;
+
+  float ax = destination.x;
+  float ay = destination.y;
+  float bx = destination.x + destination.width;
+  float by = destination.y + destination.height;
+
+  // Counter-clockwise from the top-left like raylib's own quads.
+  ::rlTexCoord2f(u0, v0);
+  EmitVertex(ax, ay, tint);
+  ::rlTexCoord2f(u0, v1);
+  EmitVertex(ax, by, tint);
+  ::rlTexCoord2f(u1, v1);
+  EmitVertex(bx, by, tint);
+  ::rlTexCoord2f(u1, v0);
+  EmitVertex(bx, ay, tint);
+}
+
+// DrawTextureView draws the source, normalized to the region of the texture,
+// into the destination.
+void DrawTextureView(
+    const ::Texture2D& texture, const ::Rectangle& region,
+    const ::Rectangle& source, const ::Rectangle& destination) {
+  if (texture.id == 0u) {
+    return;
+  }
+
+  if (::rlCheckBufferLimit(4)) {
+    ::rlglDraw();
+  }
+
+  ::rlEnableTexture(texture.id);
+  ::rlBegin(RL_QUADS);
+  EmitQuad(
+      region, source, destination,
+      ::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff });
+  ::rlEnd();
+  ::rlDisableTexture();
+}
+
+int ReadLz(void* user, char* data, int size) {
+  asset::LzReader& reader = *reinterpret_cast<asset::LzReader*>(user);
+
+  return static_cast<int>(reader.Read(
+        reinterpret_cast<uint8_t*>(data), static_cast<size_t>(size)));
+}
+
+void SkipLz(void* user, int n) {
+  asset::LzReader& reader = *reinterpret_cast<asset::LzReader*>(user);
+
+  uint8_t skipped[256];
+  while (n > 0 && !reader.IsDone()) {
+    n -= static_cast<int>(reader.Read(
+          skipped, std::min(sizeof(skipped), static_cast<size_t>(n))));
+  }
+}
+
+int IsLzDone(void* user) {
+  return reinterpret_cast<asset::LzReader*>(user)->IsDone();
+}
+
 ::Image LoadImageFromFile(const File& file) {
   // Stolen directly from raylib's image handling since they don't provide a way
   // to load an image with bytes.
@@ -31,8 +464,18 @@ Real ConvertDimensionToPixel(const Dimension& dimension, Real pixels) {
 
   int comp = 0;
 
-  image.data = stbi_load_from_memory(
-      file.bytes, file.n, &image.width, &image.height, &comp, 0);
+  if (file.encoding == Encoding::kLz) {
+    // Decoded bytes are streamed into the decoder rather than decoding the
+    // whole file first.
+    asset::LzReader reader{file};
+    stbi_io_callbacks callbacks{ .read = ReadLz, .skip = SkipLz, .eof = IsLzDone };
+
+    image.data = stbi_load_from_callbacks(
+        &callbacks, &reader, &image.width, &image.height, &comp, 0);
+  } else {
+    image.data = stbi_load_from_memory(
+        file.bytes, file.n, &image.width, &image.height, &comp, 0);
+  }
   image.mipmaps = 1;
   if (comp == 1) {
     image.format = UNCOMPRESSED_GRAYSCALE;
@@ -47,7 +490,8 @@ Real ConvertDimensionToPixel(const Dimension& dimension, Real pixels) {
   return image;
 }
 
-::Font LoadFontFromFile(const File& file) {
+// LoadFontFromFile returns nullopt if the font's bytes couldn't be decoded.
+std::optional<::Font> LoadFontFromFile(const File& file) {
   // Stolen directly from raylib's font handling since they don't provide a way
   // to load a font with bytes.
 
@@ -55,11 +499,33 @@ Real ConvertDimensionToPixel(const Dimension& dimension, Real pixels) {
   float font_size = 128.0;
   int char_count = 95;
 
+  // Fonts are read out of order so encoded fonts can't be streamed. The decoded
+  // bytes are only kept until the glyphs are rendered.
+  std::vector<uint8_t> decoded{};
+  const uint8_t* bytes = file.bytes;
+  if (file.encoding == Encoding::kLz) {
+    // The font is parsed without bounds-checks so it must decode to exactly
+    // the size it was encoded from.
+    if (file.decoded_n == 0u) {
+      return std::nullopt;
+    }
+    decoded.resize(file.decoded_n);
+
+    asset::LzReader reader{file};
+    size_t read = reader.Read(decoded.data(), decoded.size());
+    uint8_t extra = 0u;
+    if (reader.IsCorrupt() || read != file.decoded_n ||
+        reader.Read(&extra, 1u) != 0u || reader.IsCorrupt()) {
+      return std::nullopt;
+    }
+    bytes = decoded.data();
+  }
+
   {
     stbtt_fontinfo font_info{};
     if (stbtt_InitFont(
           &font_info,
-          reinterpret_cast<const unsigned char*>(file.bytes), 0)) {
+          reinterpret_cast<const unsigned char*>(bytes), 0)) {
       float scale_factor = stbtt_ScaleForPixelHeight(&font_info, font_size);
 
       int ascent = 0;
@@ -127,20 +593,127 @@ Real ConvertDimensionToPixel(const Dimension& dimension, Real pixels) {
 
 struct RaylibInterface::ImageType {
   ::Image image;
+  // Texture of the image uploaded the first time it's drawn and shared by all
+  // the textures of the image if it isn't on an atlas-page.
+  ::Texture2D texture;
+  Filter filter;
+  // Atlas-page and position of the image on it, if it's on one.
+  std::optional<size_t> page;
+  int x;
+  int y;
+  // Opaque images hide whatever they're drawn over.
+  bool is_opaque;
 };
 
 struct RaylibInterface::TextureType {
+  // Render-target of the texture which image-textures don't have until they're
+  // baked.
   ::RenderTexture2D target;
+  // Image drawn by image-textures which is zero once baked.
+  ImageId image;
+  int width;
+  int height;
+  Filter filter;
+  bool is_opaque;
+  // Version of the texture's pixels which changes whenever it's drawn on.
+  uint64_t version;
+};
+
+struct RaylibInterface::TextureViewType {
+  // Texture to draw which has no id if there is nothing to draw.
+  ::Texture2D texture;
+  // Region of the texture in normalized texture-coordinates. Render-targets are
+  // stored upside-down so their regions are flipped.
+  ::Rectangle region;
+};
+
+struct RaylibInterface::AtlasPageType {
+  ::Texture2D texture;
+  // Pixels are kept so images can be added and the page repacked.
+  std::vector<uint8_t> pixels;
+  SkylinePacker packer;
+  bool is_dirty;
+  Size images;
+  // Area packed and area of the images deleted since, including padding.
+  Size packed_area;
+  Size freed_area;
+};
+
+struct RaylibInterface::DrawType {
+  // Call the deferred draw which is in the frame's arena.
+  void (*call)(const void* draw);
+  const void* draw;
+};
+
+struct RaylibInterface::CommandType {
+  // Bounds of what the command draws or nullopt if it's never culled.
+  std::optional<Bounds> bounds;
+  // Opaque commands hide what's drawn before them within their bounds.
+  bool is_opaque;
+  // Texture drawn by the command if it draws one.
+  TextureId texture;
+  // Hash of the command's kind and arguments.
+  uint64_t hash;
+  DrawType draw;
+  // Text is drawn in the overlay while the scene is scaled so it stays sharp
+  // unless something drawn after it in the scene covers it.
+  bool is_text = false;
+  // Clipping commands only change where later commands draw.
+  bool is_clipping = false;
+  // Overlay commands are drawn over the scene while it's scaled.
+  bool is_overlay = false;
 };
 
 struct RaylibInterface::FontType {
   ::Font font;
 };
 
+struct RaylibInterface::PooledTextureType {
+  ::RenderTexture2D target;
+  Size released_frame;
+};
+
+template <typename F>
+RaylibInterface::DrawType RaylibInterface::Defer(const F& draw) {
+  return DrawType{
+    .call = [](const void* draw) { (*static_cast<const F*>(draw))(); },
+    .draw = frame_context_.Arena().Create<F>(draw)
+  };
+}
+
+template <typename T>
+Span<T> RaylibInterface::CopySpan(const Span<T>& values) {
+  return Span<T>{
+    .values = frame_context_.Arena().Copy(values.values, values.n),
+    .n = values.n
+  };
+}
+
 RaylibInterface::RaylibInterface() :
   is_open_{false},
   images_{}, textures_{}, fonts_{},
-  next_image_id_{}, next_texture_id_{}, next_font_id_{},
+  atlas_pages_{},
+  texture_pool_{}, released_textures_{},
+  texture_pool_hits_{}, texture_pool_misses_{},
+  pixel_buffer_{},
+  tessellation_cache_{kTessellationCacheVertices},
+  boxes_{},
+  commands_{}, is_replaying_{false}, is_recording_clipped_{false},
+  overlay_commands_{}, is_recording_overlay_{false},
+  overdraw_{}, frame_overdraw_{},
+  frame_hash_{}, presented_hash_{}, last_hash_{}, is_frame_flushed_{false},
+  scene_{}, skipped_frames_{0u},
+  scene_scale_{1.0}, is_replaying_scene_{false},
+  replay_scale_x_{1.0}, replay_scale_y_{1.0},
+  is_dynamic_resolution_{false}, governor_{},
+  window_area_{}, resizing_area_{}, resized_{},
+  resize_interval_seconds_{kResizeIntervalSeconds}, relayout_seconds_{},
+  is_relayout_frame_{false},
+  is_drawing_{false}, frame_{}, frame_context_{},
+  clock_{}, scheduler_{clock_},
+  frame_stats_{}, stats_{}, resident_bytes_{},
+  bound_texture_{}, frame_allocations_{},
+  drawing_start_{}, frame_end_{}, pacer_{}, telemetry_{},
   key_pressed_{}, selected_texture_{} { }
 
 RaylibInterface::~RaylibInterface() {
@@ -152,6 +725,15 @@ void RaylibInterface::Open() {
   // Need to set this to have at-least one value so the window isn't
   // auto-fullscreened.
   ::InitWindow(1024, 1024, "");
+  window_area_ = ScreenArea();
+  frame_allocations_ = Allocations();
+
+  // Telemetry is always published so readers can attach to programs that are
+  // already running. It can be opted out of with 'BAND_TELEMETRY=0'.
+  const char* telemetry = std::getenv("BAND_TELEMETRY");
+  if (telemetry == nullptr || std::strcmp(telemetry, "0") != 0) {
+    telemetry_.Open();
+  }
 
   is_open_ = true;
 }
@@ -164,26 +746,44 @@ void RaylibInterface::Close() {
   // Deleting resources on exit causes segfaults.
 
   ::CloseWindow();
+  telemetry_.Close();
 
   is_open_ = false;
 }
 
 void RaylibInterface::SetTargetFps(Size fps) {
-  ::SetTargetFPS(fps);
+  ::SetTargetFPS(0);
+  pacer_.SetTargetFps(fps);
+  governor_.SetTargetSeconds(
+      fps == 0u ? ResolutionGovernor::kDefaultTargetSeconds : 1.0 / fps);
+}
+
+void RaylibInterface::SetDynamicResolution(bool is_enabled) {
+  is_dynamic_resolution_ = is_enabled;
+  governor_.Reset();
+}
+
+void RaylibInterface::SetResizeInterval(Real seconds) {
+  resize_interval_seconds_ = seconds;
 }
 
 void RaylibInterface::SetWindowArea(const ::band::WindowArea& area) {
   ::SetWindowSize(
       static_cast<int>(std::round(area.width)),
       static_cast<int>(std::round(area.height)));
+
+  // Sizes set on purpose aren't coalesced.
+  window_area_ = ScreenArea();
+  resizing_area_ = std::nullopt;
 }
 
 void RaylibInterface::SetIcon(ImageId id) {
-  if (images_.find(id) == images_.end()) {
+  const ImageType* image = images_.Find(id);
+  if (image == nullptr) {
     return;
   }
 
-  ::SetWindowIcon(images_.at(id)->image);
+  ::SetWindowIcon(image->image);
 }
 
 void RaylibInterface::SetTitle(const Text& text) {
@@ -192,71 +792,251 @@ void RaylibInterface::SetTitle(const Text& text) {
 
 void RaylibInterface::ToggleFullscreen() {
   ::ToggleFullscreen();
+
+  window_area_ = ScreenArea();
+  resizing_area_ = std::nullopt;
 }
 
 ImageId RaylibInterface::LoadImage(const File& file) {
-  ImageId id = next_image_id_;
-  next_image_id_++;
-
   ::Image image = LoadImageFromFile(file);
 
-  std::unique_ptr<ImageType> image_type = std::make_unique<ImageType>();
-  image_type->image = image;
-  images_[id] = std::move(image_type);
-
-  return id;
+  return images_.Insert(ImageType{
+      .image = image,
+      .texture = ::Texture2D{},
+      .filter = Filter::kLinear,
+      .page = std::nullopt,
+      .x = 0,
+      .y = 0,
+      .is_opaque = IsImageOpaque(image) });
 }
 
 FontId RaylibInterface::LoadFont(const File& file) {
-  FontId id = next_font_id_;
-  next_font_id_++;
-
-  ::Font font = LoadFontFromFile(file);
-
-  std::unique_ptr<FontType> font_type = std::make_unique<FontType>();
-  font_type->font = font;
-  fonts_[id] = std::move(font_type);
+  std::optional<::Font> font = LoadFontFromFile(file);
+  if (!font.has_value()) {
+    return 0u;
+  }
 
-  return id;
+  resident_bytes_.fonts += TextureBytes(font.value().texture);
+  return fonts_.Insert(FontType{ .font = font.value() });
 }
 
 void RaylibInterface::StartDrawing() {
   key_pressed_ = static_cast<char>(::GetKeyPressed());
   ::BeginDrawing();
+  is_drawing_ = true;
+
+  frame_overdraw_ = OverdrawStats{};
+  bound_texture_ = std::nullopt;
+
+  drawing_start_ = std::chrono::steady_clock::now();
+  if (frame_end_.has_value()) {
+    frame_stats_.update_seconds = Seconds(frame_end_.value(), drawing_start_);
+  }
+
+  SettleWindowArea();
+
+  scene_scale_ = is_dynamic_resolution_ ? governor_.Scale() : 1.0;
+  frame_stats_.resolution_scale = scene_scale_;
+
+  ::band::WindowArea draw_area = DrawArea();
+  frame_hash_ = Hash(kHashSeed, draw_area.width, draw_area.height, scene_scale_);
+  is_frame_flushed_ = false;
+  is_recording_clipped_ = false;
+  is_recording_overlay_ = false;
 }
 
 void RaylibInterface::StopDrawing() {
+  std::chrono::steady_clock::time_point drawing_stop =
+    std::chrono::steady_clock::now();
+  frame_stats_.display_seconds = Seconds(drawing_start_, drawing_stop);
+
+  SeparateOverlay(true);
+
+  // A frame recorded exactly like the presented one is already in the scene.
+  // Frames drawn partly while recording can't be skipped since their
+  // commands were already drawn.
+  bool is_skipped = !is_frame_flushed_ && frame_hash_ == presented_hash_ &&
+    scene_ != nullptr;
+
+  // Only a frame that repeats the last one is likely to be repeated by the next
+  // so others are drawn straight to the screen rather than drawn into the
+  // scene and copied, unless the scene has to be scaled or stretched.
+  ::band::WindowArea screen_area = ScreenArea();
+  bool is_stretched = scene_scale_ < 1.0 || DrawArea() != screen_area;
+  bool is_direct = !is_skipped && !is_frame_flushed_ && !is_stretched &&
+    frame_hash_ != last_hash_;
+  last_hash_ = frame_hash_;
+
+  if (is_skipped) {
+    commands_.clear();
+    skipped_frames_++;
+  } else if (is_direct) {
+    ::ClearBackground(::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xff });
+    DrawCommands();
+    overdraw_ = frame_overdraw_;
+
+    // The scene no longer holds the presented frame so it's given back until a
+    // frame repeats.
+    if (scene_ != nullptr) {
+      ReleaseTexture(*scene_);
+      scene_ = nullptr;
+    }
+  } else {
+    FlushCommands();
+    overdraw_ = frame_overdraw_;
+    presented_hash_ = frame_hash_;
+  }
+
+  FlushBoxes();
+
+  // A scaled scene is stretched over the window, as is the last frame while
+  // the window is resized.
+  if (!is_direct) {
+    const TextureType* scene = SceneTexture();
+    ::ClearBackground(::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xff });
+    DrawTextureView(
+        scene->target.texture,
+        ::Rectangle{ .x = 0.0f, .y = 1.0f, .width = 1.0f, .height = -1.0f },
+        ::Rectangle{ .x = 0.0f, .y = 0.0f, .width = 1.0f, .height = 1.0f },
+        ::Rectangle{
+          .x = 0.0f, .y = 0.0f,
+          .width = static_cast<float>(screen_area.width),
+          .height = static_cast<float>(screen_area.height)
+        });
+  }
+  DrawOverlay();
+
+  // Pacing right before presenting also means input is polled when the frame
+  // is presented rather than before waiting so the next update sees the latest
+  // input.
+  Real waited_seconds = pacer_.Wait();
   ::EndDrawing();
+  is_drawing_ = false;
+
+  // The frame was submitted so nothing can still be drawing from the released
+  // render-targets.
+  texture_pool_.insert(
+      texture_pool_.end(),
+      released_textures_.begin(), released_textures_.end());
+  released_textures_.clear();
+
+  TrimTexturePool();
+  frame_++;
+
+  frame_context_.Finish();
+  scheduler_.Run();
+
+  std::chrono::steady_clock::time_point frame_end =
+    std::chrono::steady_clock::now();
+  frame_stats_.present_seconds = Seconds(drawing_stop, frame_end);
+  if (frame_end_.has_value()) {
+    frame_stats_.frame_seconds = Seconds(frame_end_.value(), frame_end);
+
+    // The GPU's time is only seen where presenting waits for it.
+    Real busy_seconds = frame_stats_.frame_seconds - waited_seconds;
+    if (is_dynamic_resolution_) {
+      governor_.Sample(busy_seconds);
+    }
+    if (is_relayout_frame_) {
+      relayout_seconds_ = busy_seconds;
+    }
+  }
+  frame_end_ = frame_end;
+  is_relayout_frame_ = false;
+
+  frame_stats_.resident_bytes = resident_bytes_;
+  std::optional<Size> allocations = Allocations();
+  if (allocations.has_value() && frame_allocations_.has_value()) {
+    frame_stats_.allocations =
+      allocations.value() - frame_allocations_.value();
+  }
+  stats_ = frame_stats_;
+  telemetry_.Publish(stats_);
+
+  // Stats are reset once the frame is presented so what's done while updating
+  // before the next frame is drawn counts toward it.
+  frame_stats_ = FrameStats{};
+  frame_allocations_ = Allocations();
+}
+
+::band::Frame& RaylibInterface::Frame() const {
+  return frame_context_;
+}
+
+FrameStats RaylibInterface::Stats() const {
+  return stats_;
+}
+
+::band::Scheduler& RaylibInterface::Scheduler() const {
+  return scheduler_;
 }
 
 void RaylibInterface::DeleteImage(ImageId id) {
-  if (images_.find(id) == images_.end()) {
+  ImageType* image = images_.Find(id);
+  if (image == nullptr) {
     return;
   }
 
-  ::UnloadImage(images_.at(id)->image);
-  images_.erase(id);
+  // Textures of the image outlive it.
+  textures_.ForEach([this, id](TextureId, TextureType& texture) {
+      if (texture.image == id) {
+        BakeImageTexture(texture);
+      }
+  });
+
+  UnatlasImage(*image);
+  if (image->texture.id != 0u) {
+    resident_bytes_.images -= TextureBytes(image->texture);
+    ::UnloadTexture(image->texture);
+  }
+  ::UnloadImage(image->image);
+  images_.Erase(id);
 }
 
 void RaylibInterface::DeleteAllImages() {
-  for (const auto& pair : images_) {
-    DeleteImage(pair.first);
+  textures_.ForEach([this](TextureId, TextureType& texture) {
+      if (texture.image != 0u) {
+        BakeImageTexture(texture);
+      }
+  });
+
+  images_.ForEach([](ImageId, const ImageType& image) {
+      if (image.texture.id != 0u) {
+        ::UnloadTexture(image.texture);
+      }
+      ::UnloadImage(image.image);
+  });
+  images_.Clear();
+
+  for (const AtlasPageType& page : atlas_pages_) {
+    ::UnloadTexture(page.texture);
   }
+  atlas_pages_.clear();
+  resident_bytes_.images = 0u;
+  resident_bytes_.atlas_pages = 0u;
 }
 
 void RaylibInterface::DeleteFont(FontId id) {
-  if (fonts_.find(id) == fonts_.end()) {
+  FlushCommands();
+
+  const FontType* font = fonts_.Find(id);
+  if (font == nullptr) {
     return;
   }
 
-  ::UnloadFont(fonts_.at(id)->font);
-  fonts_.erase(id);
+  resident_bytes_.fonts -= TextureBytes(font->font.texture);
+  ::UnloadFont(font->font);
+  fonts_.Erase(id);
 }
 
 void RaylibInterface::DeleteAllFonts() {
-  for (const auto& pair : fonts_) {
-    DeleteFont(pair.first);
-  }
+  FlushCommands();
+
+  fonts_.ForEach([](FontId, const FontType& font) {
+      ::UnloadFont(font.font);
+  });
+  fonts_.Clear();
+  resident_bytes_.fonts = 0u;
 }
 
 TextureId RaylibInterface::CreateBlankTexture(const Area& area) {
@@ -265,18 +1045,14 @@ TextureId RaylibInterface::CreateBlankTexture(const Area& area) {
   Real width = ConvertDimensionToPixel(area.width, draw_area.width);
   Real height = ConvertDimensionToPixel(area.height, draw_area.height);
 
-  ::RenderTexture2D texture_target = ::LoadRenderTexture(
-      std::round(width), std::round(height));
-
-  std::unique_ptr<TextureType> texture_type = std::make_unique<TextureType>();
-  texture_type->target = texture_target;
-  textures_[texture_target.texture.id] = std::move(texture_type);
-
-  return texture_target.texture.id;
+  return textures_.Insert(AcquireTexture(
+        static_cast<int>(std::round(width)),
+        static_cast<int>(std::round(height))));
 }
 
 TextureId RaylibInterface::CreateImageTexture(ImageId id, const Area& area) {
-  if (images_.find(id) == images_.end()) {
+  const ImageType* image = images_.Find(id);
+  if (image == nullptr) {
     return 0u;
   }
 
@@ -284,162 +1060,614 @@ TextureId RaylibInterface::CreateImageTexture(ImageId id, const Area& area) {
   Real width = ConvertDimensionToPixel(area.width, draw_area.width);
   Real height = ConvertDimensionToPixel(area.height, draw_area.height);
 
-  ::Image copy = ::ImageCopy(images_.at(id)->image);
-  ::ImageResize(&copy, std::round(width), std::round(height));
-
-  ::Texture2D texture = ::LoadTextureFromImage(copy);
-
-  TextureId texture_id = CreateBlankTexture(area);
-  SelectTexture(texture_id);
-
-  ::DrawTextureRec(
-      texture,
-      ::Rectangle{
-        .x = 0.0f, .y = 0.0f,
-        .width = static_cast<float>(width),
-        .height = static_cast<float>(height)
-      },
-      ::Vector2{ .x = 0.0f, .y = 0.0f },
-      ::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff });
-
-  UnselectTexture();
-  ::UnloadImage(copy);
-  ::UnloadTexture(texture);
-
-  return texture_id;
+  return textures_.Insert(TextureType{
+      .target = ::RenderTexture2D{},
+      .image = id,
+      .width = static_cast<int>(std::round(width)),
+      .height = static_cast<int>(std::round(height)),
+      .filter = Filter::kLinear,
+      .is_opaque = image->is_opaque,
+      .version = 0u });
 }
 
 void RaylibInterface::DeleteTexture(TextureId id) {
-  if (textures_.find(id) == textures_.end()) {
+  FlushCommands(id);
+  FlushBoxes();
+
+  const TextureType* texture = textures_.Find(id);
+  if (texture == nullptr) {
     return;
   }
 
-  ::UnloadRenderTexture(textures_.at(id)->target);
-  textures_.erase(id);
+  ReleaseTexture(*texture);
+  textures_.Erase(id);
 }
 
 void RaylibInterface::DeleteAllTextures() {
-  for (const auto& pair : textures_) {
-    DeleteTexture(pair.first);
-  }
+  FlushCommands();
+  FlushBoxes();
+
+  textures_.ForEach([this](TextureId, const TextureType& texture) {
+      ReleaseTexture(texture);
+  });
+  textures_.Clear();
 }
 
 void RaylibInterface::SelectTexture(TextureId id) {
-  if (selected_texture_.has_value() ||
-      textures_.find(id) == textures_.end()) {
+  // Recorded commands have to see the texture as it was when they were
+  // recorded.
+  FlushCommands(id);
+  FlushBoxes();
+
+  TextureType* texture = textures_.Find(id);
+  if (selected_texture_.has_value() || texture == nullptr) {
     return;
   }
 
-  ::BeginTextureMode(textures_.at(id)->target);
+  if (texture->image != 0u) {
+    BakeImageTexture(*texture);
+  }
+
+  ::BeginTextureMode(texture->target);
   selected_texture_ = id;
+  texture->version++;
+  frame_stats_.target_switches++;
 }
 
 void RaylibInterface::UnselectTexture() {
+  FlushBoxes();
+
   if (!selected_texture_.has_value()) {
     return;
   }
 
   ::EndTextureMode();
+  frame_stats_.target_switches++;
+
+  // Mipmaps are stale once the texture is drawn on.
+  TextureType* texture = textures_.Find(selected_texture_.value());
+  if (texture != nullptr && texture->filter == Filter::kMipmap) {
+    ::GenTextureMipmaps(&texture->target.texture);
+  }
+
   selected_texture_ = std::nullopt;
 }
 
-void RaylibInterface::DrawTexture(TextureId id, const Point& position) {
-  if (textures_.find(id) == textures_.end()) {
+void RaylibInterface::SetTextureFilter(TextureId id, const Filter& filter) {
+  TextureType* texture = textures_.Find(id);
+  if (texture == nullptr) {
     return;
   }
 
-  ::band::WindowArea draw_area = DrawArea();
+  texture->filter = filter;
 
-  Real x = ConvertDimensionToPixel(position.x, draw_area.width);
-  Real y = ConvertDimensionToPixel(position.y, draw_area.height);
+  if (texture->image != 0u) {
+    ImageType* image = images_.Find(texture->image);
+    if (image == nullptr) {
+      return;
+    }
 
-  DrawTextureRec(
-      textures_.at(id)->target.texture,
-      ::Rectangle{
-        .x = 0.0f, .y = 0.0f,
-        .width = static_cast<float>(textures_.at(id)->target.texture.width),
-        .height = -static_cast<float>(textures_.at(id)->target.texture.height)
-      },
-      ::Vector2{ .x = static_cast<float>(x), .y = static_cast<float>(y) },
-      ::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff });
-}
+    image->filter = filter;
+    if (filter != Filter::kLinear) {
+      // Other filters would bleed between neighbours on an atlas-page so the
+      // image gets its own texture the next time it's drawn.
+      UnatlasImage(*image);
+    }
+    if (image->texture.id != 0u) {
+      ApplyFilter(image->texture, filter);
+    }
 
-void RaylibInterface::Clear(const Color& color) {
-  ::ClearBackground(
-      ::Color{ .r = color.r, .g = color.g, .b = color.b, .a = color.a });
+    return;
+  }
+
+  ApplyFilter(texture->target.texture, filter);
 }
 
-void RaylibInterface::DrawLine(
-    const Line& line, const Dimension& thickness,
-    const Leg& leg, const Color& color) {
-  ::band::WindowArea draw_area = DrawArea();
+uint64_t RaylibInterface::TextureVersion(TextureId id) const {
+  const TextureType* texture = textures_.Find(id);
+  return texture == nullptr ? 0u : texture->version;
+}
 
-  Real ax = ConvertDimensionToPixel(line.a.x, draw_area.width);
-  Real ay = ConvertDimensionToPixel(line.a.y, draw_area.height);
+void RaylibInterface::DrawTexture(TextureId id, const Point& position) {
+  if (IsRecording()) {
+    const TextureType* texture = textures_.Find(id);
+    if (texture == nullptr) {
+      return;
+    }
 
-  Real bx = ConvertDimensionToPixel(line.b.x, draw_area.width);
-  Real by = ConvertDimensionToPixel(line.b.y, draw_area.height);
+    Bounds bounds = PointsBounds({ position }, DrawArea(), 0.0f);
+    bounds.right += texture->width;
+    bounds.bottom += texture->height;
+
+    Record(CommandType{
+        .bounds = bounds,
+        .is_opaque = texture->is_opaque,
+        .texture = id,
+        .hash = Hash(
+            kHashSeed, CommandKind::kTexture, id, texture->version, position),
+        .draw = Defer([this, id, position]() {
+          DrawTexture(id, position);
+        }) });
+    return;
+  }
 
-  Real real_thickness = leg == Leg::kWidth ?
-    ConvertDimensionToPixel(thickness, draw_area.width) :
-    ConvertDimensionToPixel(thickness, draw_area.height);
+  FlushBoxes();
 
-  DrawLineEx(
-      ::Vector2{
-        .x = static_cast<float>(ax),
-        .y = static_cast<float>(ay)
-      },
-      ::Vector2{
-        .x = static_cast<float>(bx),
-        .y = static_cast<float>(by)
-      },
-      static_cast<float>(real_thickness),
-      ::Color{ .r = color.r, .g = color.g, .b = color.b, .a = color.a });
-}
+  const TextureType* texture = textures_.Find(id);
+  if (texture == nullptr) {
+    return;
+  }
 
-void RaylibInterface::DrawCircle(
-    const Circle& circle, const Leg& leg, const Color& color) {
   ::band::WindowArea draw_area = DrawArea();
 
-  Real x = ConvertDimensionToPixel(circle.center.x, draw_area.width);
-  Real y = ConvertDimensionToPixel(circle.center.y, draw_area.height);
+  Real x = ConvertDimensionToPixel(position.x, draw_area.width);
+  Real y = ConvertDimensionToPixel(position.y, draw_area.height);
 
-  Real radius = leg == Leg::kWidth ?
-    ConvertDimensionToPixel(circle.radius, draw_area.width) :
-    ConvertDimensionToPixel(circle.radius, draw_area.height);
+  TextureViewType view = ViewTexture(*texture);
+  frame_stats_.draw_calls.textures++;
+  CountBind(view.texture.id);
 
-  ::DrawCircleV(
-      ::Vector2{
-        .x = static_cast<float>(x),
-        .y = static_cast<float>(y)
-      },
-      static_cast<float>(radius),
-      ::Color{ .r = color.r, .g = color.g, .b = color.b, .a = color.a });
+  DrawTextureView(
+      view.texture, view.region,
+      ::Rectangle{ .x = 0.0f, .y = 0.0f, .width = 1.0f, .height = 1.0f },
+      ::Rectangle{
+        .x = static_cast<float>(x), .y = static_cast<float>(y),
+        .width = static_cast<float>(texture->width),
+        .height = static_cast<float>(texture->height)
+      });
 }
 
-void RaylibInterface::DrawRectangle(
-    const Rectangle& rectangle, const Color& color) {
-  ::band::WindowArea draw_area = DrawArea();
+void RaylibInterface::DrawTexture(
+    TextureId id, const Point& position, const Area& area) {
+  if (IsRecording()) {
+    const TextureType* texture = textures_.Find(id);
+    if (texture == nullptr) {
+      return;
+    }
 
-  Real ax = ConvertDimensionToPixel(rectangle.bottom_left.x, draw_area.width);
-  Real ay = ConvertDimensionToPixel(rectangle.bottom_left.y, draw_area.height);
-  Real bx = ConvertDimensionToPixel(rectangle.top_right.x, draw_area.width);
-  Real by = ConvertDimensionToPixel(rectangle.top_right.y, draw_area.height);
+    ::band::WindowArea draw_area = DrawArea();
+
+    Record(CommandType{
+        .bounds = PointsBounds(
+            {
+              position,
+              Point{
+                .x = AddDimensions(position.x, area.width, draw_area.width),
+                .y = AddDimensions(position.y, area.height, draw_area.height)
+              }
+            },
+            draw_area, 0.0f),
+        .is_opaque = texture->is_opaque,
+        .texture = id,
+        .hash = Hash(
+            kHashSeed, CommandKind::kScaledTexture, id, texture->version,
+            position, area),
+        .draw = Defer([this, id, position, area]() {
+          DrawTexture(id, position, area);
+        }) });
+    return;
+  }
 
-  ::DrawRectangleV(
-      ::Vector2{
-        .x = static_cast<float>(ax),
-        .y = static_cast<float>(ay)
-      },
-      ::Vector2{
-        .x = static_cast<float>(bx - ax),
-        .y = static_cast<float>(by - ay)
+  FlushBoxes();
+
+  const TextureType* texture = textures_.Find(id);
+  if (texture == nullptr) {
+    return;
+  }
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  Real x = ConvertDimensionToPixel(position.x, draw_area.width);
+  Real y = ConvertDimensionToPixel(position.y, draw_area.height);
+  Real width = ConvertDimensionToPixel(area.width, draw_area.width);
+  Real height = ConvertDimensionToPixel(area.height, draw_area.height);
+
+  TextureViewType view = ViewTexture(*texture);
+  frame_stats_.draw_calls.textures++;
+  CountBind(view.texture.id);
+
+  DrawTextureView(
+      view.texture, view.region,
+      ::Rectangle{ .x = 0.0f, .y = 0.0f, .width = 1.0f, .height = 1.0f },
+      ::Rectangle{
+        .x = static_cast<float>(x), .y = static_cast<float>(y),
+        .width = static_cast<float>(width),
+        .height = static_cast<float>(height)
+      });
+}
+
+void RaylibInterface::DrawTexture(
+    TextureId id, const Rectangle& source, const Rectangle& destination) {
+  if (IsRecording()) {
+    const TextureType* texture = textures_.Find(id);
+    if (texture == nullptr) {
+      return;
+    }
+
+    Record(CommandType{
+        .bounds = PointsBounds(
+            { destination.bottom_left, destination.top_right },
+            DrawArea(), 0.0f),
+        .is_opaque = texture->is_opaque,
+        .texture = id,
+        .hash = Hash(
+            kHashSeed, CommandKind::kTextureRegion, id, texture->version,
+            source, destination),
+        .draw = Defer([this, id, source, destination]() {
+          DrawTexture(id, source, destination);
+        }) });
+    return;
+  }
+
+  FlushBoxes();
+
+  const TextureType* texture = textures_.Find(id);
+  if (texture == nullptr) {
+    return;
+  }
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  Real ax = ConvertDimensionToPixel(destination.bottom_left.x, draw_area.width);
+  Real ay = ConvertDimensionToPixel(destination.bottom_left.y, draw_area.height);
+  Real bx = ConvertDimensionToPixel(destination.top_right.x, draw_area.width);
+  Real by = ConvertDimensionToPixel(destination.top_right.y, draw_area.height);
+
+  if (texture->width <= 0 || texture->height <= 0) {
+    return;
+  }
+
+  // The source is normalized to the texture.
+  Real sax = ConvertDimensionToPixel(source.bottom_left.x, texture->width) /
+    texture->width;
+  Real say = ConvertDimensionToPixel(source.bottom_left.y, texture->height) /
+    texture->height;
+  Real sbx = ConvertDimensionToPixel(source.top_right.x, texture->width) /
+    texture->width;
+  Real sby = ConvertDimensionToPixel(source.top_right.y, texture->height) /
+    texture->height;
+
+  TextureViewType view = ViewTexture(*texture);
+  frame_stats_.draw_calls.textures++;
+  CountBind(view.texture.id);
+
+  DrawTextureView(
+      view.texture, view.region,
+      ::Rectangle{
+        .x = static_cast<float>(sax), .y = static_cast<float>(say),
+        .width = static_cast<float>(sbx - sax),
+        .height = static_cast<float>(sby - say)
       },
+      ::Rectangle{
+        .x = static_cast<float>(ax), .y = static_cast<float>(ay),
+        .width = static_cast<float>(bx - ax),
+        .height = static_cast<float>(by - ay)
+      });
+}
+
+void RaylibInterface::DrawSprites(
+    TextureId id, const Point& position, const Span<Sprite>& sprites) {
+  if (IsRecording()) {
+    ::band::WindowArea draw_area = DrawArea();
+
+    Bounds origin = PointsBounds({ position }, draw_area, 0.0f);
+    Bounds bounds{
+      .left = origin.left, .top = origin.top,
+      .right = origin.right, .bottom = origin.bottom
+    };
+    for (size_t i = 0u; i < sprites.n; i++) {
+      Bounds sprite = PointsBounds(
+          {
+            sprites.values[i].destination.bottom_left,
+            sprites.values[i].destination.top_right
+          },
+          draw_area, 0.0f);
+
+      bounds.left = std::min(bounds.left, origin.left + sprite.left);
+      bounds.top = std::min(bounds.top, origin.top + sprite.top);
+      bounds.right = std::max(bounds.right, origin.left + sprite.right);
+      bounds.bottom = std::max(bounds.bottom, origin.top + sprite.bottom);
+    }
+
+    Span<Sprite> copy = CopySpan(sprites);
+    Record(CommandType{
+        .bounds = bounds,
+        .is_opaque = false,
+        .texture = id,
+        .hash = Hash(
+            kHashSeed, CommandKind::kSprites, id, TextureVersion(id),
+            position, sprites),
+        .draw = Defer([this, id, position, copy]() {
+          DrawSprites(id, position, copy);
+        }) });
+    return;
+  }
+
+  FlushBoxes();
+
+  const TextureType* texture = textures_.Find(id);
+  if (texture == nullptr || texture->width <= 0 || texture->height <= 0) {
+    return;
+  }
+
+  TextureViewType view = ViewTexture(*texture);
+  if (view.texture.id == 0u || sprites.n == 0u) {
+    return;
+  }
+  frame_stats_.draw_calls.sprites++;
+  CountBind(view.texture.id);
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  Real x = ConvertDimensionToPixel(position.x, draw_area.width);
+  Real y = ConvertDimensionToPixel(position.y, draw_area.height);
+
+  // Quads are emitted directly rather than through 'DrawTexturePro' so every
+  // sprite lands in the same draw-call of raylib's batch.
+  for (size_t start = 0u; start < sprites.n; start += kSpritesPerBatch) {
+    size_t end = std::min(start + kSpritesPerBatch, sprites.n);
+
+    if (::rlCheckBufferLimit(static_cast<int>(4u * (end - start)))) {
+      ::rlglDraw();
+    }
+
+    ::rlEnableTexture(view.texture.id);
+    ::rlBegin(RL_QUADS);
+
+    for (size_t i = start; i < end; i++) {
+      const Sprite& sprite = sprites.values[i];
+
+      float sax = static_cast<float>(ConvertDimensionToPixel(
+            sprite.source.bottom_left.x, texture->width) / texture->width);
+      float say = static_cast<float>(ConvertDimensionToPixel(
+            sprite.source.bottom_left.y, texture->height) / texture->height);
+      float sbx = static_cast<float>(ConvertDimensionToPixel(
+            sprite.source.top_right.x, texture->width) / texture->width);
+      float sby = static_cast<float>(ConvertDimensionToPixel(
+            sprite.source.top_right.y, texture->height) / texture->height);
+
+      float ax = static_cast<float>(x + ConvertDimensionToPixel(
+            sprite.destination.bottom_left.x, draw_area.width));
+      float ay = static_cast<float>(y + ConvertDimensionToPixel(
+            sprite.destination.bottom_left.y, draw_area.height));
+      float bx = static_cast<float>(x + ConvertDimensionToPixel(
+            sprite.destination.top_right.x, draw_area.width));
+      float by = static_cast<float>(y + ConvertDimensionToPixel(
+            sprite.destination.top_right.y, draw_area.height));
+
+      EmitQuad(
+          view.region,
+          ::Rectangle{
+            .x = sax, .y = say, .width = sbx - sax, .height = sby - say
+          },
+          ::Rectangle{ .x = ax, .y = ay, .width = bx - ax, .height = by - ay },
+          ::Color{
+            .r = sprite.tint.r, .g = sprite.tint.g,
+            .b = sprite.tint.b, .a = sprite.tint.a
+          });
+    }
+
+    ::rlEnd();
+    ::rlDisableTexture();
+  }
+}
+
+void RaylibInterface::Clear(const Color& color) {
+  if (IsRecording()) {
+    // Nothing drawn before a clear is seen.
+    Record(CommandType{
+        .bounds = WindowBounds(DrawArea()),
+        .is_opaque = true,
+        .texture = 0u,
+        .hash = Hash(kHashSeed, CommandKind::kClear, color),
+        .draw = Defer([this, color]() { Clear(color); }) });
+    return;
+  }
+
+  FlushBoxes();
+  frame_stats_.draw_calls.clears++;
+
+  ::ClearBackground(
       ::Color{ .r = color.r, .g = color.g, .b = color.b, .a = color.a });
 }
 
+void RaylibInterface::StartClipping(const Rectangle& rectangle) {
+  if (IsRecording()) {
+    Record(CommandType{
+        .bounds = std::nullopt,
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(kHashSeed, CommandKind::kStartClipping, rectangle),
+        .draw = Defer([this, rectangle]() { StartClipping(rectangle); }),
+        .is_clipping = true });
+    is_recording_clipped_ = true;
+    return;
+  }
+
+  FlushBoxes();
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  Real ax = ConvertDimensionToPixel(
+      rectangle.bottom_left.x, draw_area.width) * replay_scale_x_;
+  Real ay = ConvertDimensionToPixel(
+      rectangle.bottom_left.y, draw_area.height) * replay_scale_y_;
+  Real bx = ConvertDimensionToPixel(
+      rectangle.top_right.x, draw_area.width) * replay_scale_x_;
+  Real by = ConvertDimensionToPixel(
+      rectangle.top_right.y, draw_area.height) * replay_scale_y_;
+
+  int x = static_cast<int>(std::round(std::min(ax, bx)));
+  int y = static_cast<int>(std::round(std::min(ay, by)));
+  int width = static_cast<int>(std::round(std::abs(bx - ax)));
+  int height = static_cast<int>(std::round(std::abs(by - ay)));
+
+  // raylib flips the scissor by the window's height even while drawing on a
+  // texture.
+  const TextureType* selected = SelectedTexture();
+  if (is_replaying_scene_) {
+    y += ::GetScreenHeight() - scene_->height;
+  } else if (selected != nullptr) {
+    y += ::GetScreenHeight() - selected->height;
+  }
+
+  ::BeginScissorMode(x, y, width, height);
+}
+
+void RaylibInterface::StopClipping() {
+  if (IsRecording()) {
+    Record(CommandType{
+        .bounds = std::nullopt,
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(kHashSeed, CommandKind::kStopClipping),
+        .draw = Defer([this]() { StopClipping(); }),
+        .is_clipping = true });
+    is_recording_clipped_ = false;
+    return;
+  }
+
+  FlushBoxes();
+
+  ::EndScissorMode();
+}
+
+void RaylibInterface::StartOverlay() {
+  is_recording_overlay_ = true;
+}
+
+void RaylibInterface::StopOverlay() {
+  is_recording_overlay_ = false;
+}
+
+void RaylibInterface::DrawLine(
+    const Line& line, const Dimension& thickness,
+    const Leg& leg, const Color& color) {
+  if (IsRecording()) {
+    ::band::WindowArea draw_area = DrawArea();
+
+    Record(CommandType{
+        .bounds = PointsBounds(
+            { line.a, line.b }, draw_area,
+            static_cast<float>(
+              ConvertLegToPixel(thickness, leg, draw_area) / 2.0)),
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(
+            kHashSeed, CommandKind::kLine, line, thickness, leg, color),
+        .draw = Defer([this, line, thickness, leg, color]() {
+          DrawLine(line, thickness, leg, color);
+        }) });
+    return;
+  }
+
+  FlushBoxes();
+  frame_stats_.draw_calls.lines++;
+  CountBind(0u);
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  float ax = ConvertDimensionToPixel(line.a.x, draw_area.width);
+  float ay = ConvertDimensionToPixel(line.a.y, draw_area.height);
+
+  float bx = ConvertDimensionToPixel(line.b.x, draw_area.width);
+  float by = ConvertDimensionToPixel(line.b.y, draw_area.height);
+
+  float half_thickness =
+    ConvertLegToPixel(thickness, leg, draw_area) / 2.0;
+  ::Color c{ .r = color.r, .g = color.g, .b = color.b, .a = color.a };
+
+  // Lines are only 6 vertices so they're cheaper to emit than to cache.
+  EmitTriangles(1u, 6u, [&](size_t) {
+      EmitLine(ax, ay, bx, by, half_thickness, c);
+  });
+}
+
+void RaylibInterface::DrawCircle(
+    const Circle& circle, const Leg& leg, const Color& color) {
+  if (IsRecording()) {
+    ::band::WindowArea draw_area = DrawArea();
+
+    Record(CommandType{
+        .bounds = PointsBounds(
+            { circle.center }, draw_area,
+            static_cast<float>(
+              std::abs(ConvertLegToPixel(circle.radius, leg, draw_area)))),
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(kHashSeed, CommandKind::kCircle, circle, leg, color),
+        .draw = Defer([this, circle, leg, color]() {
+          DrawCircle(circle, leg, color);
+        }) });
+    return;
+  }
+
+  FlushBoxes();
+  frame_stats_.draw_calls.circles++;
+  CountBind(0u);
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  float x = ConvertDimensionToPixel(circle.center.x, draw_area.width);
+  float y = ConvertDimensionToPixel(circle.center.y, draw_area.height);
+
+  float radius = ConvertLegToPixel(circle.radius, leg, draw_area);
+
+  EmitTessellation(
+      TessellateCachedCircle(radius), x, y,
+      ::Color{ .r = color.r, .g = color.g, .b = color.b, .a = color.a });
+}
+
+void RaylibInterface::DrawRectangle(
+    const Rectangle& rectangle, const Color& color) {
+  DrawBox(Box{ .rectangle = rectangle, .color = color, .thickness = {} });
+}
+
+void RaylibInterface::DrawBox(const Box& box) {
+  if (IsRecording()) {
+    ::band::WindowArea draw_area = DrawArea();
+
+    Bounds bounds = PointsBounds(
+        { box.rectangle.bottom_left, box.rectangle.top_right },
+        draw_area, 0.0f);
+    Real thickness = ConvertDimensionToPixel(
+        box.thickness, std::min(draw_area.width, draw_area.height));
+    bool is_filled = thickness <= 0.0 ||
+      2.0 * thickness >= std::min(
+          bounds.right - bounds.left, bounds.bottom - bounds.top);
+
+    Record(CommandType{
+        .bounds = bounds,
+        .is_opaque = is_filled && box.color.a == 0xff,
+        .texture = 0u,
+        .hash = Hash(kHashSeed, CommandKind::kBox, box),
+        .draw = Defer([this, box]() { DrawBox(box); }) });
+    return;
+  }
+
+  boxes_.push_back(box);
+  frame_stats_.draw_calls.rectangles++;
+}
+
 void RaylibInterface::DrawTriangle(
     const Triangle& triangle, const Color& color) {
+  if (IsRecording()) {
+    Record(CommandType{
+        .bounds = PointsBounds(
+            { triangle.a, triangle.b, triangle.c }, DrawArea(), 0.0f),
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(kHashSeed, CommandKind::kTriangle, triangle, color),
+        .draw = Defer([this, triangle, color]() {
+          DrawTriangle(triangle, color);
+        }) });
+    return;
+  }
+
+  FlushBoxes();
+  frame_stats_.draw_calls.triangles++;
+  CountBind(0u);
+
   ::band::WindowArea draw_area = DrawArea();
 
   Real ax = ConvertDimensionToPixel(triangle.a.x, draw_area.width);
@@ -456,15 +1684,310 @@ void RaylibInterface::DrawTriangle(
       ::Color{ .r = color.r, .g = color.g, .b = color.b, .a = color.a });
 }
 
+void RaylibInterface::DrawLines(
+    const Span<Line>& lines, const Dimension& thickness,
+    const Leg& leg, const Color& color) {
+  if (IsRecording()) {
+    // Bulk primitives are drawn in order but never culled.
+    Span<Line> copy = CopySpan(lines);
+    Record(CommandType{
+        .bounds = std::nullopt,
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(
+            kHashSeed, CommandKind::kLines, lines, thickness, leg, color),
+        .draw = Defer([this, copy, thickness, leg, color]() {
+          DrawLines(copy, thickness, leg, color);
+        }) });
+    return;
+  }
+
+  FlushBoxes();
+
+  if (lines.n == 0u) {
+    return;
+  }
+
+  frame_stats_.draw_calls.lines++;
+  CountBind(0u);
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  float* ax = PixelBuffer(4u * lines.n);
+  float* ay = ax + lines.n;
+  float* bx = ay + lines.n;
+  float* by = bx + lines.n;
+
+  ConvertToPixels(
+      lines, [](const Line& line) -> const Dimension& { return line.a.x; },
+      draw_area.width, ax);
+  ConvertToPixels(
+      lines, [](const Line& line) -> const Dimension& { return line.a.y; },
+      draw_area.height, ay);
+  ConvertToPixels(
+      lines, [](const Line& line) -> const Dimension& { return line.b.x; },
+      draw_area.width, bx);
+  ConvertToPixels(
+      lines, [](const Line& line) -> const Dimension& { return line.b.y; },
+      draw_area.height, by);
+
+  float half_thickness = static_cast<float>(
+      ConvertLegToPixel(thickness, leg, draw_area) / 2.0);
+  ::Color c{ .r = color.r, .g = color.g, .b = color.b, .a = color.a };
+
+  EmitTriangles(lines.n, 6u, [&](size_t i) {
+      EmitLine(ax[i], ay[i], bx[i], by[i], half_thickness, c);
+  });
+}
+
+void RaylibInterface::DrawCircles(
+    const Span<Circle>& circles, const Leg& leg, const Color& color) {
+  if (IsRecording()) {
+    // Bulk primitives are drawn in order but never culled.
+    Span<Circle> copy = CopySpan(circles);
+    Record(CommandType{
+        .bounds = std::nullopt,
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(kHashSeed, CommandKind::kCircles, circles, leg, color),
+        .draw = Defer([this, copy, leg, color]() {
+          DrawCircles(copy, leg, color);
+        }) });
+    return;
+  }
+
+  FlushBoxes();
+
+  if (circles.n == 0u) {
+    return;
+  }
+
+  frame_stats_.draw_calls.circles++;
+  CountBind(0u);
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  float* x = PixelBuffer(3u * circles.n);
+  float* y = x + circles.n;
+  float* radius = y + circles.n;
+
+  ConvertToPixels(
+      circles,
+      [](const Circle& circle) -> const Dimension& { return circle.center.x; },
+      draw_area.width, x);
+  ConvertToPixels(
+      circles,
+      [](const Circle& circle) -> const Dimension& { return circle.center.y; },
+      draw_area.height, y);
+  ConvertToPixels(
+      circles,
+      [](const Circle& circle) -> const Dimension& { return circle.radius; },
+      leg == Leg::kWidth ? draw_area.width : draw_area.height, radius);
+
+  ::Color c{ .r = color.r, .g = color.g, .b = color.b, .a = color.a };
+
+  for (size_t i = 0u; i < circles.n; i++) {
+    EmitTessellation(TessellateCachedCircle(radius[i]), x[i], y[i], c);
+  }
+}
+
+void RaylibInterface::DrawRectangles(
+    const Span<Rectangle>& rectangles, const Color& color) {
+  if (IsRecording()) {
+    // Bulk primitives are drawn in order but never culled.
+    Span<Rectangle> copy = CopySpan(rectangles);
+    Record(CommandType{
+        .bounds = std::nullopt,
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(kHashSeed, CommandKind::kRectangles, rectangles, color),
+        .draw = Defer([this, copy, color]() {
+          DrawRectangles(copy, color);
+        }) });
+    return;
+  }
+
+  ::Color c{ .r = color.r, .g = color.g, .b = color.b, .a = color.a };
+  DrawRectangleBatch(rectangles, [&c](size_t) { return c; });
+}
+
+void RaylibInterface::DrawRectangles(
+    const Span<Rectangle>& rectangles, const Span<Color>& colors) {
+  if (IsRecording()) {
+    // Bulk primitives are drawn in order but never culled.
+    Span<Rectangle> rectangles_copy = CopySpan(rectangles);
+    Span<Color> colors_copy = CopySpan(colors);
+    Record(CommandType{
+        .bounds = std::nullopt,
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(
+            kHashSeed, CommandKind::kColoredRectangles, rectangles, colors),
+        .draw = Defer([this, rectangles_copy, colors_copy]() {
+          DrawRectangles(rectangles_copy, colors_copy);
+        }) });
+    return;
+  }
+
+  DrawRectangleBatch(
+      Span<Rectangle>{
+        .values = rectangles.values,
+        .n = std::min(rectangles.n, colors.n)
+      },
+      [&colors](size_t i) {
+        const Color& color = colors.values[i];
+        return ::Color{
+          .r = color.r, .g = color.g, .b = color.b, .a = color.a
+        };
+      });
+}
+
+template <typename F>
+void RaylibInterface::DrawRectangleBatch(
+    const Span<Rectangle>& rectangles, const F& color) {
+  FlushBoxes();
+
+  if (rectangles.n == 0u) {
+    return;
+  }
+
+  frame_stats_.draw_calls.rectangles++;
+  CountBind(0u);
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  float* ax = PixelBuffer(4u * rectangles.n);
+  float* ay = ax + rectangles.n;
+  float* bx = ay + rectangles.n;
+  float* by = bx + rectangles.n;
+
+  ConvertToPixels(
+      rectangles,
+      [](const Rectangle& rectangle) -> const Dimension& {
+        return rectangle.bottom_left.x;
+      },
+      draw_area.width, ax);
+  ConvertToPixels(
+      rectangles,
+      [](const Rectangle& rectangle) -> const Dimension& {
+        return rectangle.bottom_left.y;
+      },
+      draw_area.height, ay);
+  ConvertToPixels(
+      rectangles,
+      [](const Rectangle& rectangle) -> const Dimension& {
+        return rectangle.top_right.x;
+      },
+      draw_area.width, bx);
+  ConvertToPixels(
+      rectangles,
+      [](const Rectangle& rectangle) -> const Dimension& {
+        return rectangle.top_right.y;
+      },
+      draw_area.height, by);
+
+  EmitTriangles(rectangles.n, 6u, [&](size_t i) {
+      EmitRectangle(ax[i], ay[i], bx[i], by[i], color(i));
+  });
+}
+
+void RaylibInterface::DrawPolyline(
+    const Span<Point>& points, const Dimension& thickness,
+    const Leg& leg, const Color& color) {
+  if (IsRecording()) {
+    // Bulk primitives are drawn in order but never culled.
+    Span<Point> copy = CopySpan(points);
+    Record(CommandType{
+        .bounds = std::nullopt,
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(
+            kHashSeed, CommandKind::kPolyline, points, thickness, leg, color),
+        .draw = Defer([this, copy, thickness, leg, color]() {
+          DrawPolyline(copy, thickness, leg, color);
+        }) });
+    return;
+  }
+
+  FlushBoxes();
+
+  if (points.n < 2u) {
+    return;
+  }
+
+  frame_stats_.draw_calls.lines++;
+  CountBind(0u);
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  float* x = PixelBuffer(2u * points.n);
+  float* y = x + points.n;
+
+  ConvertToPixels(
+      points, [](const Point& point) -> const Dimension& { return point.x; },
+      draw_area.width, x);
+  ConvertToPixels(
+      points, [](const Point& point) -> const Dimension& { return point.y; },
+      draw_area.height, y);
+
+  float half_thickness = static_cast<float>(
+      ConvertLegToPixel(thickness, leg, draw_area) / 2.0);
+  ::Color c{ .r = color.r, .g = color.g, .b = color.b, .a = color.a };
+
+  EmitTriangles(points.n - 1u, 6u, [&](size_t i) {
+      EmitLine(x[i], y[i], x[i + 1u], y[i + 1u], half_thickness, c);
+  });
+}
+
 void RaylibInterface::DrawText(
     const Text& text, const Point& position,
     const Dimension& dimension, const Color& color,
     FontId id) {
-  if (fonts_.find(id) == fonts_.end()) {
+  if (IsRecording()) {
+    Area area = MeasureTextArea(text, dimension, id);
+    // The text is copied with its terminator.
+    const char* chars = frame_context_.Arena().Copy(
+        text.c_str(), text.size() + 1u);
+
+    Record(CommandType{
+        .bounds = PointsBounds(
+            {
+              position,
+              Point{
+                .x = AddDimensions(position.x, area.width, DrawArea().width),
+                .y = AddDimensions(position.y, area.height, DrawArea().height)
+              }
+            },
+            DrawArea(), 0.0f),
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(
+            kHashSeed, CommandKind::kText, text, position, dimension, color,
+            id),
+        .draw = Defer([this, chars, position, dimension, color, id]() {
+          DrawChars(chars, position, dimension, color, id);
+        }),
+        .is_text = true });
+    return;
+  }
+
+  DrawChars(text.c_str(), position, dimension, color, id);
+}
+
+void RaylibInterface::DrawChars(
+    const char* text, const Point& position,
+    const Dimension& dimension, const Color& color,
+    FontId id) {
+  FlushBoxes();
+
+  const FontType* font_type = fonts_.Find(id);
+  if (font_type == nullptr) {
     return;
   }
 
-  ::Font font = fonts_.at(id)->font;
+  ::Font font = font_type->font;
+  frame_stats_.draw_calls.texts++;
+  CountBind(font.texture.id);
 
   ::band::WindowArea draw_area = DrawArea();
 
@@ -476,12 +1999,29 @@ void RaylibInterface::DrawText(
   ::Vector2 p{ .x = static_cast<float>(x), .y = static_cast<float>(y) };
 
   ::DrawTextEx(
-      font, text.c_str(),
+      font, text,
       p, size, spacing,
       ::Color{ .r = color.r, .g = color.g, .b = color.b, .a = color.a });
 }
 
 void RaylibInterface::DrawFps(const Point& position) {
+  if (IsRecording()) {
+    Record(CommandType{
+        .bounds = std::nullopt,
+        .is_opaque = false,
+        .texture = 0u,
+        .hash = Hash(
+            kHashSeed, CommandKind::kFps, position,
+            static_cast<uint64_t>(::GetFPS())),
+        .draw = Defer([this, position]() { DrawFps(position); }),
+        .is_text = true });
+    return;
+  }
+
+  FlushBoxes();
+  frame_stats_.draw_calls.texts++;
+  CountBind(0u);
+
   ::band::WindowArea draw_area = DrawArea();
 
   Real x = ConvertDimensionToPixel(position.x, draw_area.width);
@@ -493,11 +2033,19 @@ void RaylibInterface::DrawFps(const Point& position) {
 Area RaylibInterface::MeasureText(
     const Text& text, const Dimension& dimension,
     FontId id) const {
-  if (fonts_.find(id) == fonts_.end()) {
+  frame_stats_.measured_texts++;
+  return MeasureTextArea(text, dimension, id);
+}
+
+Area RaylibInterface::MeasureTextArea(
+    const Text& text, const Dimension& dimension,
+    FontId id) const {
+  const FontType* font_type = fonts_.Find(id);
+  if (font_type == nullptr) {
     return Area{};
   }
 
-  ::Font font = fonts_.at(id)->font;
+  ::Font font = font_type->font;
 
   ::band::WindowArea draw_area = DrawArea();
 
@@ -559,31 +2107,772 @@ std::optional<char> RaylibInterface::CharacterPressed() const {
 }
 
 Point RaylibInterface::MousePosition() const {
+  // The mouse is on the stretched frame while the window is resized.
+  ::band::WindowArea screen_area = ScreenArea();
   return Point{
     .x = Dimension{
-      .scalar = static_cast<Real>(::GetMouseX()),
+      .scalar = static_cast<Real>(::GetMouseX()) *
+        window_area_.width / std::max(screen_area.width, 1.0),
       .unit = Unit::kPixel
     },
     .y = Dimension{
-      .scalar = static_cast<Real>(::GetMouseY()),
+      .scalar = static_cast<Real>(::GetMouseY()) *
+        window_area_.height / std::max(screen_area.height, 1.0),
       .unit = Unit::kPixel
     }
   };
 }
 
 ::band::WindowArea RaylibInterface::WindowArea() const {
-  return ::band::WindowArea{
-    .width = static_cast<Real>(::GetScreenWidth()),
-    .height = static_cast<Real>(::GetScreenHeight())
+  return window_area_;
+}
+
+RaylibInterface::TexturePoolStats RaylibInterface::TexturePool() const {
+  TexturePoolStats stats{};
+  stats.hits = texture_pool_hits_;
+  stats.misses = texture_pool_misses_;
+
+  for (const PooledTextureType& pooled : texture_pool_) {
+    stats.textures++;
+    stats.bytes += TargetBytes(pooled.target);
+  }
+
+  for (const PooledTextureType& released : released_textures_) {
+    stats.textures++;
+    stats.bytes += TargetBytes(released.target);
+  }
+
+  return stats;
+}
+
+const RaylibInterface::TextureType* RaylibInterface::SelectedTexture() const {
+  if (!selected_texture_.has_value()) {
+    return nullptr;
+  }
+
+  return textures_.Find(selected_texture_.value());
+}
+
+RaylibInterface::TextureType RaylibInterface::AcquireTexture(
+    int width, int height) {
+  FlushBoxes();
+
+  TextureType texture{
+    .target = ::RenderTexture2D{},
+    .image = 0u,
+    .width = width,
+    .height = height,
+    .filter = Filter::kLinear,
+    .is_opaque = false,
+    .version = 0u
   };
+
+  // The most recently released render-target is reused first since it's the
+  // least likely to be trimmed.
+  for (size_t i = texture_pool_.size(); i > 0u; i--) {
+    ::RenderTexture2D target = texture_pool_[i - 1u].target;
+    if (target.texture.width != width || target.texture.height != height) {
+      continue;
+    }
+
+    texture_pool_.erase(
+        texture_pool_.begin() + static_cast<std::ptrdiff_t>(i - 1u));
+    texture_pool_hits_++;
+    resident_bytes_.pooled -= TargetBytes(target);
+    resident_bytes_.render_targets += TargetBytes(target);
+
+    // Reused render-targets are cleared to look freshly created and get the
+    // default filter back.
+    const TextureType* selected = SelectedTexture();
+    RenderToTarget(
+        target, selected != nullptr ? &selected->target : nullptr,
+        []() {
+          ::ClearBackground(
+              ::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0x00 });
+        });
+    ApplyFilter(target.texture, texture.filter);
+
+    texture.target = target;
+    return texture;
+  }
+
+  texture_pool_misses_++;
+
+  texture.target = ::LoadRenderTexture(width, height);
+  resident_bytes_.render_targets += TargetBytes(texture.target);
+  return texture;
+}
+
+void RaylibInterface::BakeImageTexture(TextureType& texture) {
+  FlushBoxes();
+
+  TextureViewType view = ViewTexture(texture);
+  TextureType baked = AcquireTexture(texture.width, texture.height);
+
+  const TextureType* selected = SelectedTexture();
+  RenderToTarget(
+      baked.target, selected != nullptr ? &selected->target : nullptr,
+      [&texture, &view]() {
+        DrawTextureView(
+            view.texture, view.region,
+            ::Rectangle{ .x = 0.0f, .y = 0.0f, .width = 1.0f, .height = 1.0f },
+            ::Rectangle{
+              .x = 0.0f, .y = 0.0f,
+              .width = static_cast<float>(texture.width),
+              .height = static_cast<float>(texture.height)
+            });
+      });
+
+  texture.target = baked.target;
+  texture.image = 0u;
+  ApplyFilter(texture.target.texture, texture.filter);
+}
+
+RaylibInterface::TextureViewType RaylibInterface::ViewTexture(
+    const TextureType& texture) {
+  if (texture.image == 0u) {
+    return TextureViewType{
+      .texture = texture.target.texture,
+      .region = ::Rectangle{ .x = 0.0f, .y = 1.0f, .width = 1.0f, .height = -1.0f }
+    };
+  }
+
+  ImageType* image = images_.Find(texture.image);
+  if (image == nullptr) {
+    return TextureViewType{ .texture = ::Texture2D{}, .region = ::Rectangle{} };
+  }
+
+  if (!image->page.has_value() && image->texture.id == 0u) {
+    AtlasImage(*image);
+  }
+
+  if (image->page.has_value()) {
+    AtlasPageType& page = atlas_pages_[image->page.value()];
+
+    if (page.is_dirty) {
+      // Anything batched from the page has to be drawn before the page
+      // changes under it.
+      ::rlglDraw();
+      ::UpdateTexture(page.texture, page.pixels.data());
+      page.is_dirty = false;
+    }
+
+    float size = static_cast<float>(kAtlasPageSize);
+    return TextureViewType{
+      .texture = page.texture,
+      .region = ::Rectangle{
+        .x = image->x / size,
+        .y = image->y / size,
+        .width = image->image.width / size,
+        .height = image->image.height / size
+      }
+    };
+  }
+
+  if (image->texture.id == 0u) {
+    image->texture = ::LoadTextureFromImage(image->image);
+    ApplyFilter(image->texture, image->filter);
+    resident_bytes_.images += TextureBytes(image->texture);
+  }
+
+  return TextureViewType{
+    .texture = image->texture,
+    .region = ::Rectangle{ .x = 0.0f, .y = 0.0f, .width = 1.0f, .height = 1.0f }
+  };
+}
+
+void RaylibInterface::AtlasImage(ImageType& image) {
+  // Only small images are worth sharing a page and only linear filtering
+  // doesn't bleed between neighbouring images.
+  if (image.filter != Filter::kLinear ||
+      image.image.width > kAtlasMaxImageSize ||
+      image.image.height > kAtlasMaxImageSize ||
+      image.image.data == nullptr) {
+    return;
+  }
+
+  int padded_width = image.image.width + 2 * kAtlasPadding;
+  int padded_height = image.image.height + 2 * kAtlasPadding;
+
+  std::optional<size_t> page_index{};
+  std::optional<SkylinePacker::Position> position{};
+
+  for (size_t i = 0u; i < atlas_pages_.size() && !position.has_value(); i++) {
+    position = atlas_pages_[i].packer.Pack(padded_width, padded_height);
+    page_index = i;
+  }
+
+  if (!position.has_value()) {
+    ::Image blank = ::GenImageColor(
+        kAtlasPageSize, kAtlasPageSize,
+        ::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0x00 });
+
+    atlas_pages_.push_back(AtlasPageType{
+        .texture = ::LoadTextureFromImage(blank),
+        .pixels = std::vector<uint8_t>(kAtlasPageSize * kAtlasPageSize * 4u),
+        .packer = SkylinePacker{kAtlasPageSize, kAtlasPageSize},
+        .is_dirty = false,
+        .images = 0u,
+        .packed_area = 0u,
+        .freed_area = 0u });
+    ::UnloadImage(blank);
+    resident_bytes_.atlas_pages += atlas_pages_.back().pixels.size();
+
+    page_index = atlas_pages_.size() - 1u;
+    position = atlas_pages_.back().packer.Pack(padded_width, padded_height);
+
+    if (!position.has_value()) {
+      return;
+    }
+  }
+
+  AtlasPageType& page = atlas_pages_[page_index.value()];
+  image.page = page_index;
+  image.x = position.value().x + kAtlasPadding;
+  image.y = position.value().y + kAtlasPadding;
+
+  page.images++;
+  page.packed_area += static_cast<Size>(padded_width * padded_height);
+
+  CopyToAtlasPage(image, page);
+}
+
+void RaylibInterface::UnatlasImage(ImageType& image) {
+  if (!image.page.has_value()) {
+    return;
+  }
+
+  size_t page_index = image.page.value();
+  AtlasPageType& page = atlas_pages_[page_index];
+
+  image.page = std::nullopt;
+  page.images--;
+  page.freed_area += static_cast<Size>(
+      (image.image.width + 2 * kAtlasPadding) *
+      (image.image.height + 2 * kAtlasPadding));
+
+  // Space under the skyline can't be reused so pages are repacked once enough
+  // of them is wasted.
+  if (page.images == 0u || page.freed_area * 2u > page.packed_area) {
+    RepackAtlasPage(page_index);
+  }
+
+  // Repacking can move every image to an earlier page so the page is checked
+  // again instead of using what it held before.
+  if (atlas_pages_[page_index].images == 0u) {
+    UnloadAtlasPage(page_index);
+  }
+}
+
+void RaylibInterface::RepackAtlasPage(size_t index) {
+  AtlasPageType& page = atlas_pages_[index];
+
+  page.packer.Reset();
+  std::fill(page.pixels.begin(), page.pixels.end(), 0u);
+  page.is_dirty = true;
+  page.images = 0u;
+  page.packed_area = 0u;
+  page.freed_area = 0u;
+
+  // Images are taken off of the page and put back on whichever page fits
+  // them, tallest first since that packs tightest.
+  std::vector<ImageType*> images{};
+  images_.ForEach([index, &images](ImageId, ImageType& image) {
+      if (image.page.has_value() && image.page.value() == index) {
+        image.page = std::nullopt;
+        images.push_back(&image);
+      }
+  });
+
+  std::sort(
+      images.begin(), images.end(),
+      [](const ImageType* a, const ImageType* b) {
+        return a->image.height > b->image.height;
+      });
+
+  for (ImageType* image : images) {
+    AtlasImage(*image);
+  }
+}
+
+void RaylibInterface::UnloadAtlasPage(size_t index) {
+  // Anything batched from the page has to be drawn before the page is gone.
+  ::rlglDraw();
+  ::UnloadTexture(atlas_pages_[index].texture);
+  resident_bytes_.atlas_pages -= atlas_pages_[index].pixels.size();
+  atlas_pages_.erase(
+      atlas_pages_.begin() + static_cast<std::ptrdiff_t>(index));
+
+  images_.ForEach([index](ImageId, ImageType& image) {
+      if (image.page.has_value() && image.page.value() > index) {
+        image.page = image.page.value() - 1u;
+      }
+  });
+}
+
+void RaylibInterface::CopyToAtlasPage(
+    const ImageType& image, AtlasPageType& page) {
+  ::Color* colors = ::GetImageData(image.image);
+  if (colors == nullptr) {
+    return;
+  }
+
+  for (int row = 0; row < image.image.height; row++) {
+    std::memcpy(
+        page.pixels.data() +
+          (static_cast<size_t>(image.y + row) * kAtlasPageSize + image.x) * 4u,
+        colors + static_cast<size_t>(row) * image.image.width,
+        static_cast<size_t>(image.image.width) * 4u);
+  }
+
+  RL_FREE(colors);
+  page.is_dirty = true;
+}
+
+void RaylibInterface::ReleaseTexture(const TextureType& texture) {
+  // Image-textures have no render-target until they're baked.
+  if (texture.image != 0u) {
+    return;
+  }
+
+  PooledTextureType pooled{ .target = texture.target, .released_frame = frame_ };
+  resident_bytes_.render_targets -= TargetBytes(texture.target);
+  resident_bytes_.pooled += TargetBytes(texture.target);
+
+  if (is_drawing_) {
+    released_textures_.push_back(pooled);
+  } else {
+    texture_pool_.push_back(pooled);
+  }
+}
+
+void RaylibInterface::TrimTexturePool() {
+  // The pool is ordered from least to most recently released.
+  uint64_t bytes = 0u;
+  for (const PooledTextureType& pooled : texture_pool_) {
+    bytes += TargetBytes(pooled.target);
+  }
+
+  size_t trimmed = 0u;
+  while (trimmed < texture_pool_.size() &&
+      (bytes > kTexturePoolBytes ||
+       frame_ - texture_pool_[trimmed].released_frame > kTexturePoolFrames)) {
+    bytes -= TargetBytes(texture_pool_[trimmed].target);
+    resident_bytes_.pooled -= TargetBytes(texture_pool_[trimmed].target);
+    ::UnloadRenderTexture(texture_pool_[trimmed].target);
+    trimmed++;
+  }
+
+  texture_pool_.erase(
+      texture_pool_.begin(),
+      texture_pool_.begin() + static_cast<std::ptrdiff_t>(trimmed));
+}
+
+const std::vector<float>& RaylibInterface::TessellateCachedCircle(
+    float radius) {
+  return tessellation_cache_.Find(
+      TessellationCache::Key{
+        .shape = TessellationCache::Shape::kCircle,
+        .parameters = { radius, 0.0f, 0.0f }
+      },
+      [radius]() { return TessellateCircle(radius); });
+}
+
+TessellationCache::Stats RaylibInterface::Tessellation() const {
+  return tessellation_cache_.CacheStats();
+}
+
+FramePacer::JitterStats RaylibInterface::FrameJitter() const {
+  return pacer_.Jitter();
+}
+
+RaylibInterface::OverdrawStats RaylibInterface::Overdraw() const {
+  return overdraw_;
+}
+
+Size RaylibInterface::SkippedFrames() const {
+  return skipped_frames_;
+}
+
+bool RaylibInterface::IsRecording() const {
+  return is_drawing_ && !selected_texture_.has_value() && !is_replaying_;
+}
+
+void RaylibInterface::Record(CommandType command) {
+  // Overlays are only drawn apart from the scene while it's scaled so they're
+  // drawn in order otherwise. Clipped text stays in the scene since the overlay
+  // isn't clipped.
+  bool is_scaled = scene_scale_ < 1.0;
+  command.is_overlay = is_scaled && is_recording_overlay_;
+  command.is_text = is_scaled && command.is_text && !command.is_overlay &&
+    !is_recording_clipped_;
+
+  if (is_recording_clipped_) {
+    command.is_opaque = false;
+  }
+
+  // Text is only hashed once it's known to be drawn in the scene.
+  if (!command.is_overlay && !command.is_text) {
+    frame_hash_ = Hash(frame_hash_, command.hash);
+  }
+  commands_.push_back(std::move(command));
+}
+
+void RaylibInterface::SeparateOverlay(bool is_finished) {
+  if (std::none_of(
+        commands_.begin(), commands_.end(),
+        [is_finished](const CommandType& command) {
+          return command.is_overlay || (is_finished && command.is_text);
+        })) {
+    return;
+  }
+
+  // Commands are walked from the last drawn so text is tested against what's
+  // drawn after it in the scene. Commands without bounds could cover
+  // anything.
+  Bounds* covers = frame_context_.Arena().CreateArray<Bounds>(
+      commands_.size());
+  size_t cover_count = 0u;
+  bool is_covered = false;
+
+  bool* is_moved = frame_context_.Arena().CreateArray<bool>(commands_.size());
+
+  for (size_t i = commands_.size(); i > 0u; i--) {
+    const CommandType& command = commands_[i - 1u];
+
+    if (command.is_overlay) {
+      is_moved[i - 1u] = true;
+      continue;
+    }
+
+    if (command.is_text && is_finished) {
+      bool is_hidden = is_covered ||
+        (cover_count > 0u && !command.bounds.has_value()) ||
+        (command.bounds.has_value() && std::any_of(
+          covers, covers + cover_count,
+          [&command](const Bounds& cover) {
+            return IsOverlapping(cover, command.bounds.value());
+          }));
+      if (!is_hidden) {
+        is_moved[i - 1u] = true;
+        continue;
+      }
+
+      // Where the text is drawn in the scene changes the frame as much as the
+      // text does.
+      frame_hash_ = Hash(frame_hash_, static_cast<uint64_t>(i), command.hash);
+    }
+
+    if (command.is_clipping) {
+      continue;
+    }
+    if (command.bounds.has_value()) {
+      covers[cover_count] = command.bounds.value();
+      cover_count++;
+    } else {
+      is_covered = true;
+    }
+  }
+
+  size_t kept = 0u;
+  for (size_t i = 0u; i < commands_.size(); i++) {
+    if (is_moved[i]) {
+      overlay_commands_.push_back(std::move(commands_[i]));
+    } else {
+      commands_[kept] = std::move(commands_[i]);
+      kept++;
+    }
+  }
+  commands_.resize(kept);
+}
+
+RaylibInterface::TextureType* RaylibInterface::SceneTexture() {
+  ::band::WindowArea draw_area = DrawArea();
+  int width = std::max(
+      static_cast<int>(std::round(draw_area.width * scene_scale_)), 1);
+  int height = std::max(
+      static_cast<int>(std::round(draw_area.height * scene_scale_)), 1);
+
+  if (scene_ != nullptr && scene_->width == width && scene_->height == height) {
+    return scene_.get();
+  }
+
+  if (scene_ != nullptr) {
+    ReleaseTexture(*scene_);
+  }
+
+  scene_ = std::make_unique<TextureType>(AcquireTexture(width, height));
+
+  return scene_.get();
+}
+
+void RaylibInterface::FlushCommands(std::optional<TextureId> texture) {
+  if (commands_.empty()) {
+    return;
+  }
+
+  if (texture.has_value() &&
+      std::none_of(
+        commands_.begin(), commands_.end(),
+        [&texture](const CommandType& command) {
+          return command.texture == texture.value();
+        })) {
+    return;
+  }
+
+  // Text stays in the scene when flushed early since what's drawn after it
+  // isn't known yet.
+  SeparateOverlay(false);
+  if (commands_.empty()) {
+    return;
+  }
+
+  bool* is_culled = CullCommands();
+
+  // The window is drawn into the scene which is kept between frames so
+  // identical frames don't have to be drawn again.
+  TextureType* scene = SceneTexture();
+  const TextureType* selected = SelectedTexture();
+
+  is_replaying_scene_ = true;
+  replay_scale_x_ = scene_scale_;
+  replay_scale_y_ = scene_scale_;
+  RenderToTarget(
+      scene->target, selected == nullptr ? nullptr : &selected->target,
+      [this, is_culled]() {
+        // Commands are drawn in the window's pixels scaled to the scene.
+        float scale = static_cast<float>(scene_scale_);
+        ::rlPushMatrix();
+        ::rlScalef(scale, scale, 1.0f);
+        ReplayCommands(is_culled);
+        ::rlPopMatrix();
+      });
+  is_replaying_scene_ = false;
+  replay_scale_x_ = 1.0;
+  replay_scale_y_ = 1.0;
+  commands_.clear();
+
+  is_frame_flushed_ = true;
+}
+
+void RaylibInterface::DrawCommands() {
+  if (commands_.empty()) {
+    return;
+  }
+
+  ReplayCommands(CullCommands());
+  commands_.clear();
+}
+
+bool* RaylibInterface::CullCommands() {
+  ::band::WindowArea draw_area = DrawArea();
+  Bounds window = WindowBounds(draw_area);
+  Real window_area = std::max(draw_area.width * draw_area.height, 1.0);
+
+  // Commands are walked from the last drawn so each is tested against the
+  // opaque commands drawn over it.
+  std::array<Bounds, kOccluders> occluders{};
+  std::array<Real, kOccluders> occluder_areas{};
+  size_t occluder_count = 0u;
+
+  bool* is_culled = frame_context_.Arena().CreateArray<bool>(
+      commands_.size());
+
+  for (size_t i = commands_.size(); i > 0u; i--) {
+    const CommandType& command = commands_[i - 1u];
+    frame_overdraw_.commands++;
+
+    if (!command.bounds.has_value()) {
+      continue;
+    }
+
+    const Bounds& bounds = command.bounds.value();
+    Real area = BoundsArea(bounds, window);
+    frame_overdraw_.recorded += area / window_area;
+
+    bool is_hidden = std::any_of(
+        occluders.begin(), occluders.begin() + occluder_count,
+        [&bounds](const Bounds& occluder) {
+          return ContainsBounds(occluder, bounds);
+        });
+    if (is_hidden) {
+      is_culled[i - 1u] = true;
+      frame_overdraw_.culled++;
+      continue;
+    }
+
+    frame_overdraw_.drawn += area / window_area;
+
+    if (!command.is_opaque) {
+      continue;
+    }
+
+    // The smallest occluder is replaced once there are too many.
+    if (occluder_count < kOccluders) {
+      occluders[occluder_count] = bounds;
+      occluder_areas[occluder_count] = area;
+      occluder_count++;
+    } else {
+      auto smallest = std::min_element(
+          occluder_areas.begin(), occluder_areas.end());
+      if (*smallest < area) {
+        occluders[smallest - occluder_areas.begin()] = bounds;
+        *smallest = area;
+      }
+    }
+  }
+
+  return is_culled;
+}
+
+void RaylibInterface::ReplayCommands(const bool* is_culled) {
+  // Commands can't record more commands while they're drawn.
+  is_replaying_ = true;
+  for (size_t i = 0u; i < commands_.size(); i++) {
+    if (!is_culled[i]) {
+      commands_[i].draw.call(commands_[i].draw.draw);
+    }
+  }
+  FlushBoxes();
+  is_replaying_ = false;
+}
+
+void RaylibInterface::DrawOverlay() {
+  if (overlay_commands_.empty()) {
+    return;
+  }
+
+  // The overlay is drawn in the window's pixels scaled to the screen's.
+  ::band::WindowArea draw_area = DrawArea();
+  ::band::WindowArea screen_area = ScreenArea();
+  replay_scale_x_ = screen_area.width / std::max(draw_area.width, 1.0);
+  replay_scale_y_ = screen_area.height / std::max(draw_area.height, 1.0);
+
+  is_replaying_ = true;
+  ::rlPushMatrix();
+  ::rlScalef(
+      static_cast<float>(replay_scale_x_),
+      static_cast<float>(replay_scale_y_), 1.0f);
+  for (const CommandType& command : overlay_commands_) {
+    command.draw.call(command.draw.draw);
+  }
+  FlushBoxes();
+  ::rlPopMatrix();
+  is_replaying_ = false;
+
+  replay_scale_x_ = 1.0;
+  replay_scale_y_ = 1.0;
+
+  overlay_commands_.clear();
+}
+
+void RaylibInterface::FlushBoxes() {
+  if (boxes_.empty()) {
+    return;
+  }
+
+  Span<Box> boxes{ .values = boxes_.data(), .n = boxes_.size() };
+  CountBind(0u);
+
+  ::band::WindowArea draw_area = DrawArea();
+
+  float* ax = PixelBuffer(5u * boxes.n);
+  float* ay = ax + boxes.n;
+  float* bx = ay + boxes.n;
+  float* by = bx + boxes.n;
+  float* thickness = by + boxes.n;
+
+  ConvertToPixels(
+      boxes,
+      [](const Box& box) -> const Dimension& {
+        return box.rectangle.bottom_left.x;
+      },
+      draw_area.width, ax);
+  ConvertToPixels(
+      boxes,
+      [](const Box& box) -> const Dimension& {
+        return box.rectangle.bottom_left.y;
+      },
+      draw_area.height, ay);
+  ConvertToPixels(
+      boxes,
+      [](const Box& box) -> const Dimension& {
+        return box.rectangle.top_right.x;
+      },
+      draw_area.width, bx);
+  ConvertToPixels(
+      boxes,
+      [](const Box& box) -> const Dimension& {
+        return box.rectangle.top_right.y;
+      },
+      draw_area.height, by);
+  ConvertToPixels(
+      boxes,
+      [](const Box& box) -> const Dimension& { return box.thickness; },
+      std::min(draw_area.width, draw_area.height), thickness);
+
+  // Chunks are sized for borders which have the most vertices.
+  EmitTriangles(boxes.n, 24u, [&](size_t i) {
+      const Color& color = boxes.values[i].color;
+      EmitBox(
+          ax[i], ay[i], bx[i], by[i], thickness[i],
+          ::Color{ .r = color.r, .g = color.g, .b = color.b, .a = color.a });
+  });
+
+  boxes_.clear();
+}
+
+float* RaylibInterface::PixelBuffer(size_t n) {
+  if (pixel_buffer_.size() < n) {
+    pixel_buffer_.resize(n);
+  }
+
+  return pixel_buffer_.data();
+}
+
+void RaylibInterface::CountBind(unsigned int texture) {
+  if (bound_texture_ != texture) {
+    frame_stats_.texture_binds++;
+    bound_texture_ = texture;
+  }
 }
 
 ::band::WindowArea RaylibInterface::DrawArea() const {
+  return window_area_;
+}
+
+::band::WindowArea RaylibInterface::ScreenArea() const {
   return ::band::WindowArea{
     .width = static_cast<Real>(::GetScreenWidth()),
     .height = static_cast<Real>(::GetScreenHeight())
   };
 }
 
+void RaylibInterface::SettleWindowArea() {
+  ::band::WindowArea area = ScreenArea();
+  bool is_resized = area != window_area_;
+  if (!is_resized) {
+    resizing_area_ = std::nullopt;
+    return;
+  }
+
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  if (!resizing_area_.has_value() || resizing_area_.value() != area) {
+    resizing_area_ = area;
+    resized_ = now;
+  }
+
+  bool is_settled = Seconds(resized_, now) >= resize_interval_seconds_;
+  bool is_affordable = relayout_seconds_.has_value() &&
+    relayout_seconds_.value() <= governor_.TargetSeconds();
+  if (!is_settled && !is_affordable) {
+    return;
+  }
+
+  window_area_ = area;
+  resizing_area_ = std::nullopt;
+  is_relayout_frame_ = true;
+}
+
 }  // namespace interface
 }  // namespace band
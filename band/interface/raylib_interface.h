@@ -1,12 +1,21 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 #include "band/interface.h"
+#include "band/interface/frame_pacer.h"
+#include "band/interface/resolution_governor.h"
+#include "band/interface/skyline_packer.h"
+#include "band/interface/slot_map.h"
+#include "band/interface/telemetry.h"
+#include "band/interface/tessellation_cache.h"
+#include "band/loop.h"
+#include "band/scheduler.h"
 
 namespace band {
 namespace interface {
@@ -15,8 +24,43 @@ namespace interface {
 // from being included in other translation-units.
 
 // RaylibInterface uses raylib to implement an interface.
+//
+// Textures created from images draw the image scaled rather than rendering a
+// resized copy so each image is only uploaded once. They only get their own
+// render-target once they're selected or their image is deleted.
+//
+// Deleted textures are pooled and reused by blank textures of the same size
+// rather than freeing and reallocating render-targets. Textures deleted while
+// drawing only become reusable once the frame is finished.
+//
+// Frames are drawn into a scene kept between frames so a frame that repeats the
+// presented one isn't drawn again. Since copying the scene to the screen costs
+// a pass over the whole window, frames that don't repeat the last one are drawn
+// straight to the screen unless the scene is scaled or stretched, and the scene
+// is only kept once a frame repeats.
+//
+// With dynamic resolution, the window is drawn into a scene scaled by a
+// resolution-governor which is stretched over the window when presented.
+// Overlays, and text nothing drawn after it covers, are drawn over it at the
+// window's resolution.
+//
+// Sizes the window is resized to are coalesced so controls don't lay out and
+// re-bake on every size it's dragged through. The window's area only changes
+// once the size has settled for the resize-interval or right away if the last
+// change of the area fit in a frame. Until then the last frame is drawn
+// stretched over the window.
 class RaylibInterface : public Interface {
   public:
+    // TexturePoolStats describes the render-targets kept for reuse.
+    struct TexturePoolStats {
+      Size textures = 0u;
+      uint64_t bytes = 0u;
+      // Hits and misses count the blank textures created with and without
+      // reusing a pooled render-target.
+      Size hits = 0u;
+      Size misses = 0u;
+    };
+
     RaylibInterface();
 
     // ~RaylibInterface closes the interface and frees resources.
@@ -34,6 +78,8 @@ class RaylibInterface : public Interface {
     void Close();
 
     void SetTargetFps(Size fps) override;
+    void SetDynamicResolution(bool is_enabled) override;
+    void SetResizeInterval(Real seconds) override;
     void SetWindowArea(const ::band::WindowArea& area) override;
     void SetIcon(ImageId id) override;
     void SetTitle(const Text& text) override;
@@ -41,6 +87,9 @@ class RaylibInterface : public Interface {
 
     void StartDrawing() override;
     void StopDrawing() override;
+    ::band::Frame& Frame() const override;
+    FrameStats Stats() const override;
+    ::band::Scheduler& Scheduler() const override;
 
     ImageId LoadImage(const File&) override;
     void DeleteImage(ImageId id) override;
@@ -56,16 +105,45 @@ class RaylibInterface : public Interface {
     void DeleteAllTextures() override;
     void SelectTexture(TextureId id) override;
     void UnselectTexture() override;
+    void SetTextureFilter(TextureId id, const Filter& filter) override;
+    uint64_t TextureVersion(TextureId id) const override;
     void DrawTexture(TextureId id, const Point& position) override;
+    void DrawTexture(
+        TextureId id, const Point& position, const Area& area) override;
+    void DrawTexture(
+        TextureId id, const Rectangle& source,
+        const Rectangle& destination) override;
+    void DrawSprites(
+        TextureId id, const Point& position,
+        const Span<Sprite>& sprites) override;
 
     void Clear(const Color& color) override;
+    void StartClipping(const Rectangle& rectangle) override;
+    void StopClipping() override;
+    void StartOverlay() override;
+    void StopOverlay() override;
     void DrawLine(
         const Line& line, const Dimension& thickness,
         const Leg& leg, const Color& color) override;
     void DrawCircle(
         const Circle& circle, const Leg& leg, const Color& color) override;
     void DrawRectangle(const Rectangle& rectangle, const Color& color) override;
+    void DrawBox(const Box& box) override;
     void DrawTriangle(const Triangle& triangle, const Color& color) override;
+    void DrawLines(
+        const Span<Line>& lines, const Dimension& thickness,
+        const Leg& leg, const Color& color) override;
+    void DrawCircles(
+        const Span<Circle>& circles,
+        const Leg& leg, const Color& color) override;
+    void DrawRectangles(
+        const Span<Rectangle>& rectangles, const Color& color) override;
+    void DrawRectangles(
+        const Span<Rectangle>& rectangles,
+        const Span<Color>& colors) override;
+    void DrawPolyline(
+        const Span<Point>& points, const Dimension& thickness,
+        const Leg& leg, const Color& color) override;
     void DrawText(
         const Text& text, const Point& position,
         const Dimension& dimension, const Color& color,
@@ -80,21 +158,231 @@ class RaylibInterface : public Interface {
     Point MousePosition() const override;
     ::band::WindowArea WindowArea() const override;
 
+    TexturePoolStats TexturePool() const;
+
+    struct OverdrawStats {
+      // Commands recorded in the last frame and how many were hidden by
+      // opaque commands drawn after them.
+      Size commands;
+      Size culled;
+      // Area of the window covered by the recorded and the drawn commands as a
+      // multiple of the window's area.
+      Real recorded;
+      Real drawn;
+    };
+
+    // Overdraw returns stats about the commands drawn on the window in the
+    // last frame.
+    //
+    // Commands drawn on the window are recorded and drawn when the frame is
+    // finished. Commands entirely hidden by an opaque rectangle, texture, or
+    // clear drawn after them are skipped.
+    OverdrawStats Overdraw() const;
+
+    // SkippedFrames returns how many frames weren't drawn because they were
+    // recorded exactly like the frame before them.
+    //
+    // The last drawn frame is kept in a texture which is presented instead.
+    Size SkippedFrames() const;
+
+    // Tessellation returns stats about the cache of tessellated circles.
+    TessellationCache::Stats Tessellation() const;
+
+    // FrameJitter returns how far the intervals between presented frames were
+    // from the target FPS's period since the target was last set.
+    FramePacer::JitterStats FrameJitter() const;
+
   private:
     ::band::WindowArea DrawArea() const;
+    // ScreenArea is the area the window actually has.
+    ::band::WindowArea ScreenArea() const;
+    // SettleWindowArea changes the window's area to the screen's if it has
+    // settled.
+    void SettleWindowArea();
 
     struct ImageType;
     struct TextureType;
     struct FontType;
+    struct PooledTextureType;
+    struct TextureViewType;
+    struct AtlasPageType;
+    struct CommandType;
+    struct DrawType;
+
+    const TextureType* SelectedTexture() const;
+    // AcquireTexture with a render-target of the size, reusing a pooled one if
+    // possible.
+    TextureType AcquireTexture(int width, int height);
+    // BakeImageTexture renders the image of an image-texture into its own
+    // render-target.
+    void BakeImageTexture(TextureType& texture);
+    // ViewTexture returns what is drawn to draw the texture, uploading the
+    // texture's image if needed.
+    TextureViewType ViewTexture(const TextureType& texture);
+    // AtlasImage packs the image onto an atlas-page if it's small enough to
+    // share one.
+    void AtlasImage(ImageType& image);
+    // UnatlasImage takes the image off of its atlas-page, repacking the page if
+    // enough of it is unused and unloading it if it ends up empty.
+    void UnatlasImage(ImageType& image);
+    // RepackAtlasPage packs the images of the page again from empty.
+    void RepackAtlasPage(size_t index);
+    // UnloadAtlasPage unloads the empty page and renumbers the pages after it.
+    void UnloadAtlasPage(size_t index);
+    void CopyToAtlasPage(const ImageType& image, AtlasPageType& page);
+    // ReleaseTexture pools the texture's render-target once it's safe to reuse.
+    void ReleaseTexture(const TextureType& texture);
+    // TrimTexturePool frees render-targets that weren't reused recently.
+    void TrimTexturePool();
+    // TessellateCachedCircle returns the circle's triangles around the origin.
+    const std::vector<float>& TessellateCachedCircle(float radius);
+    // IsRecording returns if commands are recorded instead of drawn.
+    bool IsRecording() const;
+    void Record(CommandType command);
+    // Defer the draw by copying it into the frame's arena.
+    template <typename F>
+    DrawType Defer(const F& draw);
+    // CopySpan into the frame's arena.
+    template <typename T>
+    Span<T> CopySpan(const Span<T>& values);
+    // MeasureTextArea like 'MeasureText' without counting it in the frame's
+    // stats.
+    Area MeasureTextArea(
+        const Text& text, const Dimension& dimension,
+        FontId id) const;
+    // DrawRectangleBatch of the rectangles colored by the function of their
+    // index.
+    template <typename F>
+    void DrawRectangleBatch(const Span<Rectangle>& rectangles, const F& color);
+    // DrawChars like 'DrawText'.
+    void DrawChars(
+        const char* text, const Point& position,
+        const Dimension& dimension, const Color& color,
+        FontId id);
+    // SceneTexture returns the texture the window is drawn into, recreating it
+    // if the window's area changed.
+    TextureType* SceneTexture();
+    // FlushCommands draws the recorded commands that aren't hidden.
+    //
+    // If a texture is passed, the commands are only drawn if one of them draws
+    // the texture.
+    void FlushCommands(std::optional<TextureId> texture = std::nullopt);
+    // DrawCommands draws the recorded commands that aren't hidden straight to
+    // the screen.
+    void DrawCommands();
+    // CullCommands returns which recorded commands are hidden by opaque
+    // commands drawn over them.
+    bool* CullCommands();
+    // ReplayCommands draws the recorded commands that aren't culled.
+    void ReplayCommands(const bool* is_culled);
+    // SeparateOverlay moves the recorded commands drawn in the overlay out of
+    // the scene's, keeping their order.
+    //
+    // Text is only moved once the frame is finished since only then is it known
+    // if anything drawn after it in the scene covers it.
+    void SeparateOverlay(bool is_finished);
+    // DrawOverlay draws the overlay's commands over the presented scene.
+    void DrawOverlay();
+    // FlushBoxes draws the queued boxes.
+    //
+    // Anything that draws something else or changes what's drawn on flushes
+    // first so boxes stay in order. raylib 2.6 has no instanced drawing so
+    // boxes are expanded into quads on the CPU and drawn in one batch rather
+    // than drawn as GPU instances.
+    void FlushBoxes();
+    // PixelBuffer returns space for n converted coordinates that's valid until
+    // the next call.
+    float* PixelBuffer(size_t n);
+    // CountBind counts a texture-bind if the texture isn't the one drawn from
+    // last.
+    void CountBind(unsigned int texture);
 
     bool is_open_;
 
-    std::unordered_map<ImageId, std::unique_ptr<ImageType>> images_;
-    std::unordered_map<TextureId, std::unique_ptr<TextureType>> textures_;
-    std::unordered_map<FontId, std::unique_ptr<FontType>> fonts_;
-    ImageId next_image_id_;
-    TextureId next_texture_id_;
-    FontId next_font_id_;
+    // Resources are stored inline and their ids are the ids of the slot-maps.
+    SlotMap<ImageType> images_;
+    SlotMap<TextureType> textures_;
+    SlotMap<FontType> fonts_;
+
+    // Small images share textures so drawing them doesn't switch textures.
+    std::vector<AtlasPageType> atlas_pages_;
+
+    std::vector<PooledTextureType> texture_pool_;
+    std::vector<PooledTextureType> released_textures_;
+    Size texture_pool_hits_;
+    Size texture_pool_misses_;
+
+    // Coordinates converted by the bulk primitives are reused between calls.
+    std::vector<float> pixel_buffer_;
+    // Circles are tessellated once and replayed at their positions.
+    TessellationCache tessellation_cache_;
+
+    // Boxes are queued until something else is drawn and then drawn at once.
+    std::vector<Box> boxes_;
+
+    std::vector<CommandType> commands_;
+    bool is_replaying_;
+    // Commands recorded while clipping may not draw their whole bounds so they
+    // can't hide others.
+    bool is_recording_clipped_;
+    // Overlays are separated from the scene while it's scaled and drawn every
+    // frame so they don't keep identical scenes from being skipped.
+    std::vector<CommandType> overlay_commands_;
+    bool is_recording_overlay_;
+    OverdrawStats overdraw_;
+    OverdrawStats frame_overdraw_;
+
+    // Hash of the commands recorded in this frame, of the frame in the scene
+    // and of the last presented frame.
+    uint64_t frame_hash_;
+    uint64_t presented_hash_;
+    uint64_t last_hash_;
+    // Frames are flushed early if a recorded texture changes.
+    bool is_frame_flushed_;
+    // Scene is kept apart from the textures so deleting textures can't lose
+    // what was already drawn into it this frame.
+    std::unique_ptr<TextureType> scene_;
+    Size skipped_frames_;
+    // Scale the scene is drawn at this frame and if the scene is being drawn.
+    Real scene_scale_;
+    bool is_replaying_scene_;
+    // Scale from the window's pixels to the pixels of what's being replayed
+    // into since scissors aren't transformed.
+    Real replay_scale_x_;
+    Real replay_scale_y_;
+    bool is_dynamic_resolution_;
+    ResolutionGovernor governor_;
+
+    // Area of the window which lags behind the screen's while it's resized.
+    ::band::WindowArea window_area_;
+    std::optional<::band::WindowArea> resizing_area_;
+    std::chrono::steady_clock::time_point resized_;
+    Real resize_interval_seconds_;
+    // Seconds the last frame that changed the window's area was busy.
+    std::optional<Real> relayout_seconds_;
+    bool is_relayout_frame_;
+
+    bool is_drawing_;
+    Size frame_;
+    // Recorded commands and other temporaries are kept in the frame's arena.
+    mutable ::band::Frame frame_context_;
+    // Jobs are run between frames once the frame is presented.
+    SteadyClock clock_;
+    mutable ::band::Scheduler scheduler_;
+    // Stats of the frame being updated and drawn and of the last drawn frame.
+    mutable FrameStats frame_stats_;
+    FrameStats stats_;
+    // Resident bytes are kept up to date as resources are added and removed.
+    FrameStats::ResidentBytes resident_bytes_;
+    std::optional<unsigned int> bound_texture_;
+    std::optional<Size> frame_allocations_;
+    std::chrono::steady_clock::time_point drawing_start_;
+    std::optional<std::chrono::steady_clock::time_point> frame_end_;
+    // Frames are presented at the target FPS by the pacer rather than raylib
+    // which only sleeps.
+    FramePacer pacer_;
+    // Stats of drawn frames are published unless 'BAND_TELEMETRY' is '0'.
+    Telemetry telemetry_;
 
     std::optional<uint32_t> key_pressed_;
 
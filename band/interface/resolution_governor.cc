@@ -0,0 +1,50 @@
+#include "band/interface/resolution_governor.h"
+
+#include <algorithm>
+
+namespace band {
+namespace interface {
+
+Real ResolutionGovernor::TargetSeconds() const {
+  return target_seconds_;
+}
+
+void ResolutionGovernor::SetTargetSeconds(Real seconds) {
+  target_seconds_ = seconds;
+  over_frames_ = 0u;
+  under_frames_ = 0u;
+}
+
+Real ResolutionGovernor::Scale() const {
+  return scale_;
+}
+
+void ResolutionGovernor::Sample(Real busy_seconds) {
+  busy_seconds_ += (busy_seconds - busy_seconds_) * kSmoothing;
+
+  over_frames_ = busy_seconds_ > target_seconds_ * kLowerRatio ?
+    over_frames_ + 1u : 0u;
+  under_frames_ = busy_seconds_ < target_seconds_ * kRaiseRatio ?
+    under_frames_ + 1u : 0u;
+
+  // Frames are sampled again from the new scale before it changes again.
+  if (over_frames_ >= kLowerFrames && scale_ > kMinScale) {
+    scale_ = std::max(scale_ - kScaleStep, kMinScale);
+    over_frames_ = 0u;
+    busy_seconds_ = target_seconds_ * kLowerRatio;
+  } else if (under_frames_ >= kRaiseFrames && scale_ < 1.0) {
+    scale_ = std::min(scale_ + kScaleStep, 1.0);
+    under_frames_ = 0u;
+    busy_seconds_ = target_seconds_ * kRaiseRatio;
+  }
+}
+
+void ResolutionGovernor::Reset() {
+  scale_ = 1.0;
+  busy_seconds_ = 0.0;
+  over_frames_ = 0u;
+  under_frames_ = 0u;
+}
+
+}  // namespace interface
+}  // namespace band
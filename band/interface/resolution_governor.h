@@ -0,0 +1,55 @@
+#pragma once
+
+#include "band/interface.h"
+
+namespace band {
+namespace interface {
+
+// ResolutionGovernor picks the scale the scene is drawn at so frames are drawn
+// within their target time.
+//
+// Frames are sampled by the seconds they were busy, which is the frame's time
+// without waiting for its deadline. The scale is lowered a step once the
+// smoothed busy time stays near the target and raised a step once it stays far
+// under it for longer. Waiting longer to raise the scale than to lower it and
+// leaving a gap between the thresholds keeps the scale from flickering between
+// steps.
+class ResolutionGovernor {
+  public:
+    static constexpr Real kDefaultTargetSeconds = 1.0 / 60.0;
+    static constexpr Real kMinScale = 0.5;
+    static constexpr Real kScaleStep = 0.125;
+
+    Real TargetSeconds() const;
+    void SetTargetSeconds(Real seconds);
+
+    // Scale of the scene from kMinScale to 1.
+    Real Scale() const;
+
+    // Sample the seconds a frame was busy, changing the scale if needed.
+    void Sample(Real busy_seconds);
+
+    // Reset to the full scale.
+    void Reset();
+
+  private:
+    // Ratios of the target the smoothed busy time must stay over to lower the
+    // scale and under to raise it.
+    static constexpr Real kLowerRatio = 0.9;
+    static constexpr Real kRaiseRatio = 0.6;
+    // Frames the smoothed busy time must stay past a threshold.
+    static constexpr Size kLowerFrames = 15u;
+    static constexpr Size kRaiseFrames = 120u;
+    // Weight of each sample in the smoothed busy time.
+    static constexpr Real kSmoothing = 0.1;
+
+    Real target_seconds_ = kDefaultTargetSeconds;
+    Real scale_ = 1.0;
+    Real busy_seconds_ = 0.0;
+    Size over_frames_ = 0u;
+    Size under_frames_ = 0u;
+
+};
+
+}  // namespace interface
+}  // namespace band
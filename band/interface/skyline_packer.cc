@@ -0,0 +1,108 @@
+#include "band/interface/skyline_packer.h"
+
+#include <algorithm>
+
+namespace band {
+namespace interface {
+
+SkylinePacker::SkylinePacker(int width, int height) :
+  width_{width}, height_{height}, skyline_{} {
+  Reset();
+}
+
+std::optional<SkylinePacker::Position> SkylinePacker::Pack(
+    int width, int height) {
+  if (width <= 0 || height <= 0) {
+    return std::nullopt;
+  }
+
+  std::optional<size_t> best_index{};
+  int best_y = 0;
+  int best_x = 0;
+
+  for (size_t i = 0u; i < skyline_.size(); i++) {
+    std::optional<int> y = Fit(i, width, height);
+    if (!y.has_value()) {
+      continue;
+    }
+
+    if (!best_index.has_value() || y.value() < best_y ||
+        (y.value() == best_y && skyline_[i].x < best_x)) {
+      best_index = i;
+      best_y = y.value();
+      best_x = skyline_[i].x;
+    }
+  }
+
+  if (!best_index.has_value()) {
+    return std::nullopt;
+  }
+
+  // The new segment replaces the parts of the segments it covers.
+  size_t index = best_index.value();
+  Segment segment{ .x = best_x, .y = best_y + height, .width = width };
+  skyline_.insert(
+      skyline_.begin() + static_cast<std::ptrdiff_t>(index), segment);
+
+  size_t i = index + 1u;
+  while (i < skyline_.size()) {
+    int covered = segment.x + segment.width - skyline_[i].x;
+    if (covered <= 0) {
+      break;
+    }
+
+    if (covered < skyline_[i].width) {
+      skyline_[i].x += covered;
+      skyline_[i].width -= covered;
+      break;
+    }
+
+    skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i));
+  }
+
+  // Neighbouring segments of the same height are merged to keep the skyline
+  // short.
+  for (size_t j = 0u; j + 1u < skyline_.size();) {
+    if (skyline_[j].y == skyline_[j + 1u].y) {
+      skyline_[j].width += skyline_[j + 1u].width;
+      skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(j + 1u));
+    } else {
+      j++;
+    }
+  }
+
+  return Position{ .x = best_x, .y = best_y };
+}
+
+void SkylinePacker::Reset() {
+  skyline_.clear();
+  skyline_.push_back(Segment{ .x = 0, .y = 0, .width = width_ });
+}
+
+std::optional<int> SkylinePacker::Fit(
+    size_t index, int width, int height) const {
+  if (skyline_[index].x + width > width_) {
+    return std::nullopt;
+  }
+
+  int y = 0;
+  int remaining = width;
+
+  for (size_t i = index; remaining > 0; i++) {
+    if (i >= skyline_.size()) {
+      return std::nullopt;
+    }
+
+    y = std::max(y, skyline_[i].y);
+    if (y + height > height_) {
+      return std::nullopt;
+    }
+
+    remaining -= skyline_[i].width;
+  }
+
+  return y;
+}
+
+}  // namespace interface
+}  // namespace band
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+namespace band {
+namespace interface {
+
+// SkylinePacker packs rectangles into an area by tracking the skyline formed
+// by the tops of the packed rectangles.
+//
+// Each rectangle is placed where its top is lowest, which is the bottom-left
+// heuristic with the vertical-axis pointing down. Space under the skyline can't
+// be reused so packers are reset and refilled to defragment them.
+class SkylinePacker {
+  public:
+    struct Position {
+      int x = 0;
+      int y = 0;
+    };
+
+    SkylinePacker(int width, int height);
+
+    // Pack a rectangle of the size returning its top-left position or nullopt
+    // if it doesn't fit.
+    std::optional<Position> Pack(int width, int height);
+
+    // Reset to an empty area.
+    void Reset();
+
+  private:
+    struct Segment {
+      int x = 0;
+      int y = 0;
+      int width = 0;
+    };
+
+    // Fit returns the y a rectangle would be placed at if its left-side was at
+    // the start of the segment at the index, or nullopt if it doesn't fit.
+    std::optional<int> Fit(size_t index, int width, int height) const;
+
+    int width_;
+    int height_;
+
+    std::vector<Segment> skyline_;
+};
+
+}  // namespace interface
+}  // namespace band
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace band {
+namespace interface {
+
+// SlotMap stores values densely and identifies them with ids encoding the index
+// of their slot and the generation of the slot.
+//
+// Finding a value is a bounds-check and a comparison of the generation. The
+// generation of a slot changes whenever the slot is erased so ids of erased
+// values never find the values that reuse the slot. An id of zero is never
+// valid.
+template <typename T>
+class SlotMap {
+  public:
+    using Id = size_t;
+
+    // Insert the value returning its id.
+    Id Insert(T value);
+
+    // Find the value with the id or nullptr if the id isn't valid.
+    T* Find(Id id);
+    const T* Find(Id id) const;
+
+    // Erase the value with the id returning if the id was valid.
+    bool Erase(Id id);
+
+    // ForEach calls the function with the id and a reference to each value.
+    template <typename F>
+    void ForEach(const F& f);
+
+    // Clear erases all values.
+    void Clear();
+
+  private:
+    // Odd generations are occupied slots.
+    static bool IsOccupied(uint32_t generation);
+
+    std::vector<T> values_{};
+    std::vector<uint32_t> generations_{};
+    std::vector<uint32_t> free_{};
+};
+
+}  // namespace interface
+}  // namespace band
+
+namespace band {
+namespace interface {
+
+template <typename T>
+typename SlotMap<T>::Id SlotMap<T>::Insert(T value) {
+  uint32_t index = 0u;
+
+  if (free_.empty()) {
+    index = static_cast<uint32_t>(values_.size());
+    values_.push_back(std::move(value));
+    generations_.push_back(0u);
+  } else {
+    index = free_.back();
+    free_.pop_back();
+    values_[index] = std::move(value);
+  }
+
+  generations_[index]++;
+
+  return static_cast<Id>(generations_[index]) << 32u | index;
+}
+
+template <typename T>
+T* SlotMap<T>::Find(Id id) {
+  uint32_t index = static_cast<uint32_t>(id);
+  uint32_t generation = static_cast<uint32_t>(id >> 32u);
+
+  if (index >= generations_.size() ||
+      generations_[index] != generation ||
+      !IsOccupied(generation)) {
+    return nullptr;
+  }
+
+  return &values_[index];
+}
+
+template <typename T>
+const T* SlotMap<T>::Find(Id id) const {
+  return const_cast<SlotMap<T>*>(this)->Find(id);
+}
+
+template <typename T>
+bool SlotMap<T>::Erase(Id id) {
+  if (Find(id) == nullptr) {
+    return false;
+  }
+
+  uint32_t index = static_cast<uint32_t>(id);
+
+  values_[index] = T{};
+  generations_[index]++;
+  free_.push_back(index);
+
+  return true;
+}
+
+template <typename T>
+template <typename F>
+void SlotMap<T>::ForEach(const F& f) {
+  for (size_t i = 0u; i < values_.size(); i++) {
+    if (!IsOccupied(generations_[i])) {
+      continue;
+    }
+
+    f(static_cast<Id>(generations_[i]) << 32u | i, values_[i]);
+  }
+}
+
+template <typename T>
+void SlotMap<T>::Clear() {
+  // Generations are kept so ids of cleared values stay invalid.
+  free_.clear();
+
+  for (size_t i = 0u; i < values_.size(); i++) {
+    if (IsOccupied(generations_[i])) {
+      values_[i] = T{};
+      generations_[i]++;
+    }
+
+    free_.push_back(static_cast<uint32_t>(values_.size() - i - 1u));
+  }
+}
+
+template <typename T>
+bool SlotMap<T>::IsOccupied(uint32_t generation) {
+  return generation % 2u == 1u;
+}
+
+}  // namespace interface
+}  // namespace band
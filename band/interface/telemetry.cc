@@ -0,0 +1,165 @@
+#include "band/interface/telemetry.h"
+
+#include <cstring>
+#include <string>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace band {
+namespace interface {
+
+namespace {
+
+template <typename T>
+void Write(uint8_t* bytes, size_t offset, T value) {
+  std::memcpy(bytes + offset, &value, sizeof(value));
+}
+
+// StoreRelease so readers that see the value also see what was written before.
+void StoreRelease(uint8_t* bytes, size_t offset, uint64_t value) {
+  __atomic_store_n(
+      reinterpret_cast<uint64_t*>(bytes + offset), value, __ATOMIC_RELEASE);
+}
+
+Size DrawCalls(const FrameStats::DrawCalls& draw_calls) {
+  return draw_calls.clears + draw_calls.textures + draw_calls.sprites +
+    draw_calls.lines + draw_calls.circles + draw_calls.rectangles +
+    draw_calls.triangles + draw_calls.texts;
+}
+
+uint64_t ResidentBytes(const FrameStats::ResidentBytes& resident_bytes) {
+  return static_cast<uint64_t>(resident_bytes.images) +
+    resident_bytes.atlas_pages + resident_bytes.render_targets +
+    resident_bytes.fonts + resident_bytes.pooled;
+}
+
+}  // namespace
+
+Telemetry::Telemetry() :
+  name_{}, fd_{-1}, bytes_{nullptr}, n_{0u}, written_{0u}, opened_{} { }
+
+Telemetry::~Telemetry() {
+  Close();
+}
+
+bool Telemetry::Open() {
+  Close();
+
+  Text name = "/band-telemetry-" + std::to_string(::getpid());
+  size_t n = kHeaderSize + kCapacity * kSampleSize;
+
+  int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0 && errno == EEXIST) {
+    // A ring left by a crashed process that had the same id is replaced, but
+    // a ring still locked by its owner isn't.
+    int existing = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (existing < 0) {
+      return false;
+    }
+    bool is_stale = ::flock(existing, LOCK_EX | LOCK_NB) == 0;
+    ::close(existing);
+    if (!is_stale) {
+      return false;
+    }
+
+    ::shm_unlink(name.c_str());
+    fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  }
+  if (fd < 0) {
+    return false;
+  }
+
+  if (::flock(fd, LOCK_EX | LOCK_NB) != 0 ||
+      ::ftruncate(fd, static_cast<off_t>(n)) != 0) {
+    ::close(fd);
+    ::shm_unlink(name.c_str());
+    return false;
+  }
+
+  void* mapping = ::mmap(
+      nullptr, n, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (mapping == MAP_FAILED) {
+    ::close(fd);
+    ::shm_unlink(name.c_str());
+    return false;
+  }
+
+  name_ = name;
+  fd_ = fd;
+  bytes_ = static_cast<uint8_t*>(mapping);
+  n_ = n;
+  written_ = 0u;
+  opened_ = std::chrono::steady_clock::now();
+
+  std::memcpy(bytes_, "BTEL", 4u);
+  Write<uint32_t>(bytes_, 4u, kVersion);
+  Write<uint32_t>(bytes_, 8u, kCapacity);
+  Write<uint32_t>(bytes_, 12u, static_cast<uint32_t>(kSampleSize));
+  StoreRelease(bytes_, 16u, 0u);
+
+  return true;
+}
+
+void Telemetry::Close() {
+  if (!IsOpen()) {
+    return;
+  }
+
+  ::munmap(bytes_, n_);
+  ::shm_unlink(name_.c_str());
+  ::close(fd_);
+
+  name_.clear();
+  fd_ = -1;
+  bytes_ = nullptr;
+  n_ = 0u;
+}
+
+bool Telemetry::IsOpen() const {
+  return bytes_ != nullptr;
+}
+
+void Telemetry::Publish(const FrameStats& stats) {
+  if (!IsOpen()) {
+    return;
+  }
+
+  uint8_t* sample = bytes_ + kHeaderSize + (written_ % kCapacity) * kSampleSize;
+
+  // The odd sequence marks the sample as being written before any of it is.
+  __atomic_store_n(
+      reinterpret_cast<uint64_t*>(sample), 2u * written_ + 1u,
+      __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  Write<double>(
+      sample, 8u,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - opened_).count());
+  Write<double>(sample, 16u, stats.frame_seconds);
+  Write<double>(sample, 24u, stats.update_seconds);
+  Write<double>(sample, 32u, stats.display_seconds);
+  Write<double>(sample, 40u, stats.present_seconds);
+  Write<uint32_t>(sample, 48u, DrawCalls(stats.draw_calls));
+  Write<uint32_t>(sample, 52u, stats.texture_binds);
+  Write<uint32_t>(sample, 56u, stats.target_switches);
+  Write<uint32_t>(sample, 60u, stats.measured_texts);
+  Write<uint64_t>(sample, 64u, ResidentBytes(stats.resident_bytes));
+  Write<int64_t>(
+      sample, 72u,
+      stats.allocations.has_value() ?
+        static_cast<int64_t>(stats.allocations.value()) : -1);
+
+  StoreRelease(sample, 0u, 2u * written_ + 2u);
+
+  written_++;
+  StoreRelease(bytes_, 16u, written_);
+}
+
+}  // namespace interface
+}  // namespace band
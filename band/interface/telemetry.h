@@ -0,0 +1,94 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "band/interface.h"
+
+namespace band {
+namespace interface {
+
+// Telemetry publishes the stats of every drawn frame into a ring in POSIX
+// shared-memory that other processes can read while the program runs.
+//
+// The ring is named '/band-telemetry-<pid>' and there is a single writer which
+// never waits for readers. Readers are expected to keep up and skip samples
+// that were overwritten. 'cmd/tail-telemetry' is a reader that prints live
+// percentiles.
+//
+// All integers and reals are native-endian and offsets are from the start of
+// the ring:
+//
+//   header:
+//     0  magic 'BTEL'
+//     4  u32 version
+//     8  u32 capacity which is the number of samples
+//     12 u32 size of each sample
+//     16 u64 number of samples written, stored after the sample is
+//     24 reserved until 64
+//   samples, each at 64 + (index % capacity) * size of each sample:
+//     0  u64 sequence which is 2 * index + 1 while the sample is written and
+//        2 * index + 2 once it's written
+//     8  f64 seconds since the ring was opened
+//     16 f64 frame seconds
+//     24 f64 update seconds
+//     32 f64 display seconds
+//     40 f64 present seconds
+//     48 u32 draw-calls
+//     52 u32 texture-binds
+//     56 u32 target-switches
+//     60 u32 measured texts
+//     64 u64 resident texture bytes
+//     72 i64 allocations or -1 if they aren't counted
+//
+// A sample was read whole if its sequence was the same once written before and
+// after reading it.
+class Telemetry {
+  public:
+    static constexpr uint32_t kVersion = 1u;
+    static constexpr uint32_t kCapacity = 4096u;
+    static constexpr size_t kHeaderSize = 64u;
+    static constexpr size_t kSampleSize = 80u;
+
+    Telemetry();
+
+    // ~Telemetry closes the ring.
+    ~Telemetry();
+
+    // Delete due to non-trivial destructor.
+    Telemetry(const Telemetry&) = delete;
+    Telemetry& operator=(const Telemetry&) = delete;
+    Telemetry(const Telemetry&&) = delete;
+    Telemetry& operator=(const Telemetry&&) = delete;
+
+    // Open the ring of the process, replacing a stale one with the same name.
+    //
+    // Owners lock their ring while it's open so a ring with the same name is
+    // only stale if it isn't locked, which keeps a live process sharing
+    // shared-memory with this one from having its ring replaced. Rings are
+    // only readable by the user.
+    //
+    // Returns false if the shared-memory couldn't be created or another live
+    // process owns a ring with the same name.
+    bool Open();
+    // Close if not already closed, removing the ring.
+    void Close();
+
+    bool IsOpen() const;
+
+    // Publish the stats of a drawn frame if the ring is open.
+    void Publish(const FrameStats& stats);
+
+  private:
+    Text name_;
+    // Descriptor of the ring which is kept open to hold its lock.
+    int fd_;
+    uint8_t* bytes_;
+    size_t n_;
+    uint64_t written_;
+    std::chrono::steady_clock::time_point opened_;
+};
+
+}  // namespace interface
+}  // namespace band
@@ -0,0 +1,68 @@
+#include "band/interface/tessellation_cache.h"
+
+#include <cmath>
+
+namespace band {
+namespace interface {
+
+namespace {
+
+// Parameters are quantized to this many steps per pixel.
+constexpr float kQuantization = 64.0f;
+
+}  // namespace
+
+TessellationCache::TessellationCache(size_t max_vertices) :
+  max_vertices_{max_vertices}, vertices_{0u}, hits_{0u}, misses_{0u},
+  entries_{}, index_{} { }
+
+void TessellationCache::Clear() {
+  entries_.clear();
+  index_.clear();
+  vertices_ = 0u;
+}
+
+TessellationCache::Stats TessellationCache::CacheStats() const {
+  return Stats{
+    .shapes = entries_.size(),
+    .vertices = vertices_,
+    .hits = hits_,
+    .misses = misses_
+  };
+}
+
+size_t TessellationCache::Hash::operator()(const QuantizedKey& key) const {
+  // FNV-1a over the values.
+  uint64_t hash = 14695981039346656037u;
+  for (int32_t value : key) {
+    hash ^= static_cast<uint32_t>(value);
+    hash *= 1099511628211u;
+  }
+
+  return static_cast<size_t>(hash);
+}
+
+TessellationCache::QuantizedKey TessellationCache::Quantize(const Key& key) {
+  QuantizedKey quantized{};
+  quantized[0] = static_cast<int32_t>(key.shape);
+
+  for (size_t i = 0u; i < kParameters; i++) {
+    quantized[i + 1u] = static_cast<int32_t>(
+        std::lround(key.parameters[i] * kQuantization));
+  }
+
+  return quantized;
+}
+
+void TessellationCache::Evict() {
+  while (vertices_ > max_vertices_ && entries_.size() > 1u) {
+    const Entry& entry = entries_.back();
+
+    vertices_ -= entry.second.size() / 2u;
+    index_.erase(entry.first);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace interface
+}  // namespace band
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace band {
+namespace interface {
+
+// TessellationCache stores the triangles of shapes keyed by the shapes'
+// parameters in pixels and evicts the least-recently-used shapes once it holds
+// more than its vertex budget.
+//
+// Parameters are quantized to a 64th of a pixel so shapes that only differ by
+// rounding share triangles. Keys should be relative to the shape's position so
+// moving shapes keep hitting.
+class TessellationCache {
+  public:
+    enum class Shape { kCircle };
+
+    static constexpr size_t kParameters = 3u;
+
+    struct Key {
+      Shape shape{};
+      std::array<float, kParameters> parameters{};
+    };
+
+    struct Stats {
+      size_t shapes = 0u;
+      size_t vertices = 0u;
+      size_t hits = 0u;
+      size_t misses = 0u;
+    };
+
+    explicit TessellationCache(size_t max_vertices);
+
+    // Find the vertices of the shape with the key, tessellating them with the
+    // function if they aren't cached.
+    //
+    // The function returns the vertices as consecutive x and y coordinates.
+    // The reference is valid until the next call.
+    template <typename F>
+    const std::vector<float>& Find(const Key& key, const F& tessellate);
+
+    // Clear all shapes.
+    void Clear();
+
+    Stats CacheStats() const;
+
+  private:
+    using QuantizedKey = std::array<int32_t, kParameters + 1u>;
+
+    struct Hash {
+      size_t operator()(const QuantizedKey& key) const;
+    };
+
+    using Entry = std::pair<QuantizedKey, std::vector<float>>;
+
+    static QuantizedKey Quantize(const Key& key);
+
+    // Evict shapes until the cache is within its budget, never evicting the
+    // most-recently-used shape.
+    void Evict();
+
+    size_t max_vertices_;
+    size_t vertices_;
+    size_t hits_;
+    size_t misses_;
+
+    // Most-recently-used shapes are at the front.
+    std::list<Entry> entries_;
+    std::unordered_map<QuantizedKey, std::list<Entry>::iterator, Hash> index_;
+};
+
+}  // namespace interface
+}  // namespace band
+
+namespace band {
+namespace interface {
+
+template <typename F>
+const std::vector<float>& TessellationCache::Find(
+    const Key& key, const F& tessellate) {
+  QuantizedKey quantized = Quantize(key);
+
+  auto it = index_.find(quantized);
+  if (it != index_.end()) {
+    hits_++;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+  }
+
+  misses_++;
+  entries_.emplace_front(quantized, tessellate());
+  index_.emplace(quantized, entries_.begin());
+  vertices_ += entries_.front().second.size() / 2u;
+
+  Evict();
+
+  return entries_.front().second;
+}
+
+}  // namespace interface
+}  // namespace band
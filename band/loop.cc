@@ -0,0 +1,79 @@
+#include "band/loop.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace band {
+
+SteadyClock::SteadyClock() : start_{std::chrono::steady_clock::now()} { }
+
+Real SteadyClock::Seconds() const {
+  return std::chrono::duration<Real>(
+      std::chrono::steady_clock::now() - start_).count();
+}
+
+Real ManualClock::Seconds() const {
+  return seconds_;
+}
+
+void ManualClock::Advance(Real seconds) {
+  seconds_ += seconds;
+}
+
+Loop::Loop(Interface& interface, const Clock& clock) :
+  interface_{interface}, clock_{clock} { }
+
+Real Loop::Timestep() const {
+  return timestep_;
+}
+
+void Loop::SetTimestep(Real seconds) {
+  if (!(seconds > 0.0)) {
+    return;
+  }
+  timestep_ = seconds;
+}
+
+Size Loop::MaxUpdates() const {
+  return max_updates_;
+}
+
+void Loop::SetMaxUpdates(Size updates) {
+  max_updates_ = updates;
+}
+
+Size Loop::DroppedUpdates() const {
+  return dropped_updates_;
+}
+
+void Loop::Step(const Update& update, const Display& display) {
+  Real seconds = clock_.Seconds();
+  if (last_seconds_.has_value()) {
+    accumulated_seconds_ += std::max(seconds - last_seconds_.value(), 0.0);
+  }
+  last_seconds_ = seconds;
+
+  Size updates = 0u;
+  while (accumulated_seconds_ >= timestep_ && updates < max_updates_) {
+    update(timestep_);
+    accumulated_seconds_ -= timestep_;
+    updates++;
+  }
+
+  if (accumulated_seconds_ >= timestep_) {
+    Real dropped = std::floor(accumulated_seconds_ / timestep_);
+    dropped_updates_ += static_cast<Size>(dropped);
+    accumulated_seconds_ -= dropped * timestep_;
+  }
+
+  interface_.Frame().SetAlpha(accumulated_seconds_ / timestep_);
+  display();
+}
+
+void Loop::Run(const Update& update, const Display& display) {
+  while (!interface_.HasAction(Interface::Action::kClose)) {
+    Step(update, display);
+  }
+}
+
+}  // namespace band
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <optional>
+
+#include "band/interface.h"
+
+namespace band {
+
+// Clock tells the seconds since an arbitrary start.
+class Clock {
+  public:
+    virtual ~Clock() = default;
+
+    virtual Real Seconds() const = 0;
+
+};
+
+// SteadyClock is a clock that never goes backwards.
+class SteadyClock : public Clock {
+  public:
+    SteadyClock();
+
+    Real Seconds() const override;
+
+  private:
+    std::chrono::steady_clock::time_point start_;
+
+};
+
+// ManualClock is a clock that only advances when told to so loops can be run
+// deterministically.
+class ManualClock : public Clock {
+  public:
+    Real Seconds() const override;
+
+    void Advance(Real seconds);
+
+  private:
+    Real seconds_ = 0.0;
+
+};
+
+// Loop drives an application by updating it at a fixed timestep and displaying
+// it once per frame.
+//
+// Updates due since the last frame are run before displaying the frame so the
+// simulation advances at the same rate no matter how fast frames are drawn.
+// Frames are drawn between updates so the frame's alpha is set to how far the
+// frame is between the last update and the next. Controls can interpolate
+// between the states of the last two updates with the alpha to move smoothly.
+//
+// At most a bounded number of updates are run each frame. Updates due past
+// that are dropped so a simulation slower than real-time slows down instead of
+// also slowing down the frames.
+class Loop {
+  public:
+    static constexpr Real kDefaultTimestep = 1.0 / 60.0;
+    static constexpr Size kDefaultMaxUpdates = 5u;
+
+    // Update advances the application by a timestep.
+    using Update = std::function<void(Real)>;
+    // Display draws a frame of the application.
+    using Display = std::function<void()>;
+
+    // Loop with a clock that must outlive the loop.
+    Loop(Interface& interface, const Clock& clock);
+
+    Real Timestep() const;
+    // SetTimestep ignores timesteps that aren't positive since no number of
+    // updates would use up the accumulated time.
+    void SetTimestep(Real seconds);
+
+    Size MaxUpdates() const;
+    void SetMaxUpdates(Size updates);
+
+    // DroppedUpdates counts the updates that were dropped for being behind.
+    Size DroppedUpdates() const;
+
+    // Step runs the due updates and displays a frame.
+    void Step(const Update& update, const Display& display);
+
+    // Run steps until the interface is closed.
+    void Run(const Update& update, const Display& display);
+
+  private:
+    Interface& interface_;
+    const Clock& clock_;
+
+    Real timestep_ = kDefaultTimestep;
+    Size max_updates_ = kDefaultMaxUpdates;
+
+    std::optional<Real> last_seconds_{};
+    Real accumulated_seconds_ = 0.0;
+    Size dropped_updates_ = 0u;
+
+};
+
+}  // namespace band
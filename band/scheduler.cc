@@ -0,0 +1,46 @@
+#include "band/scheduler.h"
+
+#include <utility>
+
+namespace band {
+
+Scheduler::Scheduler(const Clock& clock) : clock_{clock} { }
+
+Real Scheduler::BudgetSeconds() const {
+  return budget_seconds_;
+}
+
+void Scheduler::SetBudgetSeconds(Real seconds) {
+  budget_seconds_ = seconds;
+}
+
+void Scheduler::Post(Job job) {
+  jobs_.push_back(std::move(job));
+}
+
+Size Scheduler::Pending() const {
+  return static_cast<Size>(jobs_.size());
+}
+
+void Scheduler::Clear() {
+  jobs_.clear();
+}
+
+void Scheduler::Run() {
+  if (jobs_.empty()) {
+    return;
+  }
+
+  Real start = clock_.Seconds();
+  do {
+    // The job is taken off the queue before being run so it can post jobs.
+    Job job = std::move(jobs_.front());
+    jobs_.pop_front();
+
+    if (!job()) {
+      jobs_.push_back(std::move(job));
+    }
+  } while (!jobs_.empty() && clock_.Seconds() - start < budget_seconds_);
+}
+
+}  // namespace band
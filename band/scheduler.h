@@ -0,0 +1,54 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+
+#include "band/interface.h"
+#include "band/loop.h"
+
+namespace band {
+
+// Scheduler runs queued jobs on the main thread between frames within a budget
+// of seconds per frame.
+//
+// Jobs are resumable and do a slice of their work each time they're run so
+// work too big for a frame is spread over as many frames as it needs. Jobs are
+// run in turns so a big job doesn't keep the ones queued after it from
+// progressing. At least one slice is run each frame so jobs always progress.
+//
+// Frames take at most the budget plus the longest slice longer so slices should
+// be short.
+class Scheduler {
+  public:
+    static constexpr Real kDefaultBudgetSeconds = 0.004;
+
+    // Job does a slice of its work and returns if it's finished.
+    using Job = std::function<bool()>;
+
+    // Scheduler with a clock that must outlive the scheduler.
+    explicit Scheduler(const Clock& clock);
+
+    Real BudgetSeconds() const;
+    void SetBudgetSeconds(Real seconds);
+
+    // Post the job to be run once the jobs posted before it have had a turn.
+    void Post(Job job);
+
+    // Pending counts the jobs that aren't finished.
+    Size Pending() const;
+
+    // Clear the pending jobs without finishing them.
+    void Clear();
+
+    // Run slices of the pending jobs until the budget is spent or they're all
+    // finished.
+    void Run();
+
+  private:
+    const Clock& clock_;
+    Real budget_seconds_ = kDefaultBudgetSeconds;
+    std::deque<Job> jobs_{};
+
+};
+
+}  // namespace band
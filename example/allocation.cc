@@ -0,0 +1,90 @@
+#include <iostream>
+#include <optional>
+
+#include "band/all.h"
+#include "band/asset/font/helvetica.font.h"
+
+namespace {
+
+// Frames drawn before allocations are counted so caches and buffers can grow.
+constexpr size_t kWarmUpFrames = 120u;
+// Frames allocations are counted over.
+constexpr size_t kCountedFrames = 600u;
+
+}  // namespace
+
+// allocation counts the heap allocations of steady-state frames which should
+// be zero.
+//
+// Allocations are only counted if band is built with
+// 'OPTIONS=-DBAND_COUNT_ALLOCATIONS' which the example's make-target does.
+int main() {
+  if (!band::Allocations().has_value()) {
+    std::cerr << "band wasn't built with BAND_COUNT_ALLOCATIONS" << std::endl;
+    return 1;
+  }
+
+  std::unique_ptr<band::Interface> created_interface = band::DefaultInterface();
+  band::Interface& interface = *created_interface;
+
+  interface.SetTitle("allocation");
+  interface.SetTargetFps(0u);
+
+  band::FontId font_id = interface.LoadFont(band::asset::font::Helvetica());
+
+  band::control::TextStyle text_style{
+    .font_size = band::Dimension{ .scalar = 0.05, .unit = band::Unit::kRatio },
+    .font_color = band::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xff },
+    .font_id = font_id
+  };
+  band::control::ButtonStyle button_style{
+    .fill_color = band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff },
+    .hover_color = band::Color{ .r = 0xcc, .g = 0xcc, .b = 0xcc, .a = 0xff },
+    .disabled_color = band::Color{},
+    .border_color = band::Color{ .r = 0xff, .g = 0x00, .b = 0x00, .a = 0xff },
+    .horizontal_alignment = band::Alignment::kMiddle,
+    .vertical_alignment = band::Alignment::kMiddle,
+    .border_thickness = band::Dimension{
+      .scalar = 0.005,
+      .unit = band::Unit::kRatio
+    }
+  };
+
+  band::control::Label label{};
+  label.SetText("text long enough to not fit in a small string");
+  label.SetStyle(&text_style);
+
+  band::control::Label button_label{};
+  button_label.SetText("button");
+  button_label.SetStyle(&text_style);
+
+  band::control::Button<band::Control*> button{};
+  button.SetStyle(&button_style);
+  button.SetControl(&button_label);
+
+  band::control::Fps fps{};
+
+  band::control::StackPanel<band::Control*> stack_panel{};
+  stack_panel.SetAlignment(band::Alignment::kMiddle);
+  stack_panel.SetDirection(band::Direction::kVertical);
+  stack_panel.SetControls({&label, &button, &fps});
+
+  std::optional<band::Size> start{};
+  for (size_t i = 0u; i < kWarmUpFrames + kCountedFrames; i++) {
+    if (i == kWarmUpFrames) {
+      start = band::Allocations();
+    }
+
+    band::Update(band::Point{}, interface, stack_panel);
+    band::DrawFrame(
+        band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff },
+        band::Point{}, interface, stack_panel);
+  }
+
+  band::Size allocations = band::Allocations().value() - start.value();
+
+  std::cout << allocations << " allocations over " << kCountedFrames <<
+    " frames" << std::endl;
+
+  return allocations == 0u ? 0 : 1;
+}
@@ -10,19 +10,23 @@ int main() {
 
   interface.SetTitle("control");
   interface.SetTargetFps(60u);
+  interface.SetDynamicResolution(true);
   interface.SetWindowArea(band::WindowArea{ .width = 1024.0, .height = 1024.0 });
 
   band::FontId font_id = interface.LoadFont(band::asset::font::Helvetica());
   band::ImageId icon_id = interface.LoadImage(Icon());
   interface.SetIcon(icon_id);
 
+  // Both labels share the same style.
+  band::control::TextStyle text_style{
+    .font_size = band::Dimension{ .scalar = 0.1, .unit = band::Unit::kRatio },
+    .font_color = band::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xff },
+    .font_id = font_id
+  };
+
   band::control::Label label{};
   label.SetText("control");
-  label.SetFontSize(
-      band::Dimension{ .scalar = 0.1, .unit = band::Unit::kRatio });
-  label.SetFontColor(
-      band::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xff });
-  label.SetFontId(font_id);
+  label.SetStyle(&text_style);
 
   band::control::Separator separator{};
   separator.SetArea(band::Area{
@@ -52,30 +56,29 @@ int main() {
 
   band::control::Label button_control{};
   button_control.SetText("button");
-  button_control.SetFontSize(
-      band::Dimension{ .scalar = 0.1, .unit = band::Unit::kRatio });
-  button_control.SetFontColor(
-      band::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xff });
-  button_control.SetFontId(font_id);
+  button_control.SetStyle(&text_style);
 
   using PointerStackPanel = band::control::StackPanel<band::Control*>;
   using PointerFixedPanel = band::control::FixedPanel<band::Control*>;
   using PointerAnchor = band::control::Anchor<band::Control*>;
   using PointerButton = band::control::Button<band::Control*>;
+  using PointerLayer = band::control::Layer<band::Control*>;
+
+  band::control::ButtonStyle button_style{
+    .fill_color = band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff },
+    .hover_color = band::Color{ .r = 0xcc, .g = 0xcc, .b = 0xcc, .a = 0xff },
+    .disabled_color = band::Color{},
+    .border_color = band::Color{ .r = 0xff, .g = 0x00, .b = 0x00, .a = 0xff },
+    .horizontal_alignment = band::Alignment::kMiddle,
+    .vertical_alignment = band::Alignment::kMiddle,
+    .border_thickness = band::Dimension{
+      .scalar = 0.005,
+      .unit = band::Unit::kRatio
+    }
+  };
 
   PointerButton button{};
-  button.SetFillColor(
-      band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff });
-  button.SetHoverColor(
-      band::Color{ .r = 0xcc, .g = 0xcc, .b = 0xcc, .a = 0xff });
-  button.SetHorizontalAlignment(band::Alignment::kMiddle);
-  button.SetVerticalAlignment(band::Alignment::kMiddle);
-  button.SetBorderColor(
-      band::Color{ .r = 0xff, .g = 0x00, .b = 0x00, .a = 0xff  });
-  button.SetBorderThickness(band::Dimension{
-        .scalar = 0.005,
-        .unit = band::Unit::kRatio
-      });
+  button.SetStyle(&button_style);
   button.SetControl(&button_control);
 
   PointerStackPanel stack_panel{};
@@ -83,8 +86,11 @@ int main() {
   stack_panel.SetDirection(band::Direction::kVertical);
   stack_panel.SetControls({&label, &padding, &separator, &padding, &button});
 
-  band::control::Texture texture{};
-  band::Scope scope{[&texture, &interface]() { texture.CleanUp(interface); }};
+  // The layer captures the stack-panel once it stops changing and recaptures
+  // it when it changes.
+  PointerLayer layer{};
+  layer.SetControl(&stack_panel);
+  band::Scope scope{[&layer, &interface]() { layer.CleanUp(interface); }};
 
   PointerAnchor update_anchor{};
   update_anchor.SetHorizontalAlignment(band::Alignment::kMiddle);
@@ -100,35 +106,35 @@ int main() {
   anchor.SetReferenceArea(::band::Area{
       .width = band::Dimension{ .scalar = 1.0, .unit = band::Unit::kRatio },
       .height = band::Dimension{ .scalar = 1.0, .unit = band::Unit::kRatio } });
-  anchor.SetControl(&texture);
-
-  band::control::Fps fps{};
+  anchor.SetControl(&layer);
+
+  band::control::TextStyle hud_text_style{
+    .font_size = band::Dimension{ .scalar = 0.02, .unit = band::Unit::kRatio },
+    .font_color = band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff },
+    .font_id = font_id
+  };
+
+  band::control::PerfHud hud{};
+  hud.SetArea(band::Area{
+      .width = band::Dimension{ .scalar = 0.4, .unit = band::Unit::kRatio },
+      .height = band::Dimension{ .scalar = 0.2, .unit = band::Unit::kRatio } });
+  hud.SetStyle(&hud_text_style);
+  hud.SetBackgroundColor(
+      band::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xc0 });
+  hud.SetGraphColor(band::Color{ .r = 0x00, .g = 0xff, .b = 0x00, .a = 0xff });
 
   PointerFixedPanel fixed_panel{};
-  fixed_panel.SetControls({ {&fps, band::Point{}}, {&anchor, band::Point{}} });
-
-  bool first_frame = true;
-  band::WindowArea last_window_area{};
-  PointerButton::Action last_action{};
+  fixed_panel.SetControls({ {&anchor, band::Point{}}, {&hud, band::Point{}} });
 
   while (!interface.HasAction(band::Interface::Action::kClose)) {
     band::Update(band::Point{}, interface, update_anchor);
+    band::Update(band::Point{}, interface, hud);
 
     PointerButton::Action current_action = button.LastAction();
     if (current_action == PointerButton::Action::kPress) {
       std::cout << "button pressed" << std::endl;
     }
 
-    if (first_frame ||
-        last_window_area != interface.WindowArea() ||
-        current_action != last_action) {
-      first_frame = false;
-
-      texture.CaptureControl(interface, stack_panel);
-      last_window_area = interface.WindowArea();
-      last_action = current_action;
-    }
-
     band::DrawFrame(
         band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff },
         band::Point{}, interface, fixed_panel);
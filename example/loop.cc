@@ -0,0 +1,99 @@
+#include <chrono>
+#include <thread>
+
+#include "band/all.h"
+
+namespace {
+
+// Timestep of the simulation which is purposely slower than frames are drawn
+// so interpolating between updates is visible.
+constexpr band::Real kTimestep = 1.0 / 20.0;
+// Seconds an update takes while backspace is held so the simulation runs
+// slower than real-time.
+constexpr band::Real kHeavyUpdateSeconds = 0.08;
+
+constexpr band::Real kSide = 0.1;
+constexpr band::Real kSpeed = 0.5;
+
+// Ball bounces between the sides of the window.
+struct Ball {
+  band::Real x = 0.0;
+  band::Real velocity = kSpeed;
+};
+
+void Advance(Ball& ball, band::Real seconds) {
+  ball.x += ball.velocity * seconds;
+  if (ball.x < 0.0) {
+    ball.x = -ball.x;
+    ball.velocity = kSpeed;
+  }
+  if (ball.x > 1.0 - kSide) {
+    ball.x = 2.0 * (1.0 - kSide) - ball.x;
+    ball.velocity = -kSpeed;
+  }
+}
+
+band::Rectangle BallRectangle(band::Real x, band::Real y) {
+  return band::Rectangle{
+    .bottom_left = band::Point{
+      .x = band::Dimension{ .scalar = x, .unit = band::Unit::kRatio },
+      .y = band::Dimension{ .scalar = y, .unit = band::Unit::kRatio }
+    },
+    .top_right = band::Point{
+      .x = band::Dimension{ .scalar = x + kSide, .unit = band::Unit::kRatio },
+      .y = band::Dimension{ .scalar = y + kSide, .unit = band::Unit::kRatio }
+    }
+  };
+}
+
+}  // namespace
+
+// loop draws a ball simulated at a fixed timestep twice: interpolated between
+// updates on top and as of the last update on the bottom. Holding backspace
+// makes updates slower than real-time, which slows the ball but not the frames.
+int main() {
+  std::unique_ptr<band::Interface> created_interface = band::DefaultInterface();
+  band::Interface& interface = *created_interface;
+
+  interface.SetTitle("loop");
+  interface.SetTargetFps(60u);
+  interface.SetWindowArea(band::WindowArea{ .width = 1024.0, .height = 1024.0 });
+
+  band::SteadyClock clock{};
+  band::Loop loop{interface, clock};
+  loop.SetTimestep(kTimestep);
+
+  Ball previous{};
+  Ball current{};
+
+  loop.Run(
+      [&](band::Real seconds) {
+        if (interface.HasAction(band::Interface::Action::kBackspace)) {
+          std::this_thread::sleep_for(
+              std::chrono::duration<band::Real>(kHeavyUpdateSeconds));
+        }
+
+        previous = current;
+        Advance(current, seconds);
+      },
+      [&]() {
+        band::Real alpha = interface.Frame().Alpha();
+
+        interface.StartDrawing();
+        interface.Clear(
+            band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff });
+
+        // Interpolating positions across a bounce would cut the corner so the
+        // ball is drawn where it was after the last update instead.
+        band::Real x = previous.velocity == current.velocity ?
+          previous.x + (current.x - previous.x) * alpha : current.x;
+        interface.DrawRectangle(
+            BallRectangle(x, 0.3),
+            band::Color{ .r = 0x00, .g = 0x80, .b = 0x00, .a = 0xff });
+        interface.DrawRectangle(
+            BallRectangle(current.x, 0.6),
+            band::Color{ .r = 0x80, .g = 0x00, .b = 0x00, .a = 0xff });
+
+        interface.StopDrawing();
+      });
+}
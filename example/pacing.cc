@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+#include "band/interface/frame_pacer.h"
+
+namespace {
+
+using Clock = band::interface::FramePacer::Clock;
+using JitterStats = band::interface::FramePacer::JitterStats;
+
+constexpr band::Size kFps = 120u;
+// Frames paced for each kind of waiting.
+constexpr band::Size kFrames = 360u;
+
+// Work spins for a different part of the period each frame like frames that
+// draw different amounts do.
+void Work(band::Size frame) {
+  Clock::time_point stop = Clock::now() +
+    std::chrono::microseconds(1000u + frame % 7u * 500u);
+  while (Clock::now() < stop) { }
+}
+
+// SleepJitter is the jitter of frames that only sleep until their deadline.
+JitterStats SleepJitter() {
+  Clock::duration period = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<band::Real>(1.0 / kFps));
+
+  JitterStats jitter{};
+  Clock::time_point deadline = Clock::now() + period;
+  Clock::time_point last = Clock::now();
+  for (band::Size i = 0u; i < kFrames; i++) {
+    Work(i);
+    std::this_thread::sleep_until(deadline);
+    deadline += period;
+
+    Clock::time_point now = Clock::now();
+    band::Real seconds = std::abs(
+        std::chrono::duration<band::Real>(now - last - period).count());
+    last = now;
+
+    band::Size bin = static_cast<band::Size>(std::min(
+          seconds / band::interface::FramePacer::kJitterBinSeconds,
+          band::Real{band::interface::FramePacer::kJitterBins - 1u}));
+    jitter.histogram[bin]++;
+    jitter.intervals++;
+    jitter.max_seconds = std::max(jitter.max_seconds, seconds);
+  }
+
+  return jitter;
+}
+
+// PacerJitter is the jitter of frames paced by the frame-pacer.
+JitterStats PacerJitter(band::Real& margin_seconds) {
+  band::interface::FramePacer pacer;
+  pacer.SetTargetFps(kFps);
+
+  for (band::Size i = 0u; i < kFrames; i++) {
+    Work(i);
+    pacer.Wait();
+  }
+
+  margin_seconds = pacer.MarginSeconds();
+  return pacer.Jitter();
+}
+
+void Report(const band::Text& name, const JitterStats& jitter) {
+  std::cout << name << ": max " << jitter.max_seconds * 1000.0 << "ms" <<
+    std::endl;
+  for (band::Size i = 0u; i < band::interface::FramePacer::kJitterBins; i++) {
+    if (jitter.histogram[i] == 0u) {
+      continue;
+    }
+    std::cout << "  " <<
+      i * band::interface::FramePacer::kJitterBinSeconds * 1000.0 << "ms" <<
+      (i + 1u == band::interface::FramePacer::kJitterBins ? "+" : "") <<
+      ": " << jitter.histogram[i] << std::endl;
+  }
+}
+
+}  // namespace
+
+// pacing reports how far frame intervals are from the period when only
+// sleeping between frames against when paced by the frame-pacer.
+int main() {
+  band::Real margin_seconds = 0.0;
+
+  Report("sleep", SleepJitter());
+  Report("pacer", PacerJitter(margin_seconds));
+  std::cout << "pacer margin: " << margin_seconds * 1000.0 << "ms" <<
+    std::endl;
+}
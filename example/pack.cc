@@ -0,0 +1,45 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "band/all.h"
+#include "band/asset/asset.pack.h"
+#include "band/asset/lz.h"
+#include "band/asset/pack.h"
+
+// pack reports how much the embedded pack's encoding saves against how long
+// each file takes to decode.
+int main() {
+  band::asset::Pack pack{};
+  if (!pack.Open(band::asset::Assets())) {
+    std::cerr << "embedded pack is invalid" << std::endl;
+    return 1;
+  }
+
+  std::vector<uint8_t> buffer(1u << 16u);
+
+  for (const band::Text& name : pack.Names()) {
+    band::File file = pack.Find(name).value();
+
+    if (file.encoding == band::Encoding::kRaw) {
+      std::cout << name << ": " << file.n << " bytes, raw" << std::endl;
+      continue;
+    }
+
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+    band::asset::LzReader reader{file};
+    size_t decoded = 0u;
+    while (!reader.IsDone()) {
+      decoded += reader.Read(buffer.data(), buffer.size());
+    }
+
+    std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    std::cout << name << ": " << decoded << " -> " << file.n << " bytes, " <<
+      "saved " << decoded - file.n << " bytes, " <<
+      "decoded in " << elapsed.count() << "ms" << std::endl;
+  }
+}
@@ -0,0 +1,95 @@
+#include <cstdio>
+#include <memory>
+
+#include "band/all.h"
+#include "band/asset/font/helvetica.font.h"
+
+namespace {
+
+// Rows of the table formatted by each burst of work.
+constexpr band::Size kRows = 200000u;
+// Rows formatted by each slice of the job.
+constexpr band::Size kRowsPerSlice = 500u;
+
+// Table is formatted in slices by a scheduled job.
+struct Table {
+  band::Text text{};
+  band::Size rows = 0u;
+};
+
+// FormatTable posts a job formatting the rows of a new table.
+void FormatTable(band::Interface& interface, std::shared_ptr<Table> table) {
+  *table = Table{};
+  interface.Scheduler().Post([table]() {
+      char row[64];
+      for (band::Size i = 0u; i < kRowsPerSlice && table->rows < kRows; i++) {
+        int n = std::snprintf(
+            row, sizeof(row), "%8u | %12.4f | %08x\n",
+            table->rows, table->rows * 0.001, table->rows * 2654435761u);
+        table->text.append(row, static_cast<size_t>(n));
+        table->rows++;
+      }
+
+      return table->rows == kRows;
+    });
+}
+
+}  // namespace
+
+// scheduler formats a big table with a scheduled job which is spread over
+// frames instead of stalling one. Clicking formats the table again.
+int main() {
+  std::unique_ptr<band::Interface> created_interface = band::DefaultInterface();
+  band::Interface& interface = *created_interface;
+
+  interface.SetTitle("scheduler");
+  interface.SetTargetFps(60u);
+  interface.SetWindowArea(band::WindowArea{ .width = 1024.0, .height = 1024.0 });
+
+  band::FontId font_id = interface.LoadFont(band::asset::font::Helvetica());
+
+  band::control::TextStyle hud_text_style{
+    .font_size = band::Dimension{ .scalar = 0.02, .unit = band::Unit::kRatio },
+    .font_color = band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff },
+    .font_id = font_id
+  };
+
+  band::control::PerfHud hud{};
+  hud.SetArea(band::Area{
+      .width = band::Dimension{ .scalar = 0.4, .unit = band::Unit::kRatio },
+      .height = band::Dimension{ .scalar = 0.2, .unit = band::Unit::kRatio } });
+  hud.SetStyle(&hud_text_style);
+  hud.SetBackgroundColor(
+      band::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xc0 });
+  hud.SetGraphColor(band::Color{ .r = 0x00, .g = 0xff, .b = 0x00, .a = 0xff });
+
+  std::shared_ptr<Table> table = std::make_shared<Table>();
+  FormatTable(interface, table);
+
+  band::Text progress{};
+  while (!interface.HasAction(band::Interface::Action::kClose)) {
+    if (interface.HasAction(band::Interface::Action::kLeftClick)) {
+      interface.Scheduler().Clear();
+      FormatTable(interface, table);
+    }
+
+    band::Update(band::Point{}, interface, hud);
+
+    progress = "formatted " + std::to_string(table->rows) + " of " +
+      std::to_string(kRows) + " rows";
+
+    interface.StartDrawing();
+    interface.Clear(band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff });
+    interface.DrawText(
+        progress,
+        band::Point{
+          .x = band::Dimension{ .scalar = 0.1, .unit = band::Unit::kRatio },
+          .y = band::Dimension{ .scalar = 0.5, .unit = band::Unit::kRatio }
+        },
+        band::Dimension{ .scalar = 0.05, .unit = band::Unit::kRatio },
+        band::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xff },
+        font_id);
+    hud.Display(band::Point{}, interface);
+    interface.StopDrawing();
+  }
+}
@@ -0,0 +1,97 @@
+#include <malloc.h>
+
+#include <iostream>
+#include <vector>
+
+#include "band/all.h"
+
+namespace {
+
+// Controls created for each kind.
+constexpr size_t kControls = 100000u;
+
+// HeapBytes in use, including big blocks that are mapped on their own.
+size_t HeapBytes() {
+  struct mallinfo2 info = ::mallinfo2();
+  return info.uordblks + info.hblkhd;
+}
+
+// Measure the heap bytes taken by n controls made by the function, which
+// styles each control either by sharing the style or setting its fields.
+template <typename C, typename F>
+size_t Measure(const F& make) {
+  size_t start = HeapBytes();
+
+  std::vector<C> controls(kControls);
+  for (C& control : controls) {
+    make(control);
+  }
+
+  return HeapBytes() - start;
+}
+
+// Report the bytes n of a control take with shared styles against with a style
+// per control.
+void Report(const band::Text& name, size_t shared, size_t owned) {
+  std::cout << name << ": " <<
+    owned / kControls << " -> " << shared / kControls << " bytes each, " <<
+    owned << " -> " << shared << " bytes for " << kControls << ", " <<
+    "saved " << owned - shared << " bytes" << std::endl;
+}
+
+}  // namespace
+
+// style measures how much sharing styles between controls saves on the heap
+// against styling each control by setting its fields.
+int main() {
+  band::control::TextStyle text_style{
+    .font_size = band::Dimension{ .scalar = 0.1, .unit = band::Unit::kRatio },
+    .font_color = band::Color{ .r = 0x00, .g = 0x00, .b = 0x00, .a = 0xff },
+    .font_id = 0u
+  };
+  band::control::ButtonStyle button_style{
+    .fill_color = band::Color{ .r = 0xff, .g = 0xff, .b = 0xff, .a = 0xff },
+    .hover_color = band::Color{ .r = 0xcc, .g = 0xcc, .b = 0xcc, .a = 0xff },
+    .disabled_color = band::Color{},
+    .border_color = band::Color{ .r = 0xff, .g = 0x00, .b = 0x00, .a = 0xff },
+    .horizontal_alignment = band::Alignment::kMiddle,
+    .vertical_alignment = band::Alignment::kMiddle,
+    .border_thickness = band::Dimension{
+      .scalar = 0.005,
+      .unit = band::Unit::kRatio
+    }
+  };
+
+  // Texts fit in small strings so only the controls and styles are measured.
+  size_t shared_labels = Measure<band::control::Label>(
+      [&text_style](band::control::Label& label) {
+        label.SetText("label");
+        label.SetStyle(&text_style);
+      });
+  size_t owned_labels = Measure<band::control::Label>(
+      [&text_style](band::control::Label& label) {
+        label.SetText("label");
+        label.SetFontSize(text_style.font_size);
+        label.SetFontColor(text_style.font_color);
+        label.SetFontId(text_style.font_id);
+      });
+
+  using Button = band::control::Button<band::Control*>;
+  size_t shared_buttons = Measure<Button>(
+      [&button_style](Button& button) {
+        button.SetStyle(&button_style);
+      });
+  size_t owned_buttons = Measure<Button>(
+      [&button_style](Button& button) {
+        button.SetFillColor(button_style.fill_color);
+        button.SetHoverColor(button_style.hover_color);
+        button.SetDisabledColor(button_style.disabled_color);
+        button.SetBorderColor(button_style.border_color);
+        button.SetHorizontalAlignment(button_style.horizontal_alignment);
+        button.SetVerticalAlignment(button_style.vertical_alignment);
+        button.SetBorderThickness(button_style.border_thickness);
+      });
+
+  Report("label", shared_labels, owned_labels);
+  Report("button", shared_buttons, owned_buttons);
+}